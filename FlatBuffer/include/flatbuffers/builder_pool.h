@@ -0,0 +1,139 @@
+/*
+ * Copyright 2015 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_BUILDER_POOL_H_
+#define FLATBUFFERS_BUILDER_POOL_H_
+
+#include <mutex>
+
+#include "flatbuffers/flatbuffers.h"
+
+// Recycling of builders and the buffers they release, for code that
+// serializes many messages (e.g. a request/response path) and would otherwise
+// pay for a fresh builder and buffer allocation per message.
+
+namespace flatbuffers {
+
+// A pooled_allocator that may be used from multiple threads, as buffers are
+// typically released on a different thread than they were built on.
+class locked_pooled_allocator : public pooled_allocator {
+ public:
+  explicit locked_pooled_allocator(size_t max_cached_bytes)
+    : pooled_allocator(max_cached_bytes) {}
+
+  uint8_t *allocate(size_t size) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pooled_allocator::allocate(size);
+  }
+
+  void deallocate(uint8_t *p) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pooled_allocator::deallocate(p);
+  }
+
+  size_t cached_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pooled_allocator::cached_bytes();
+  }
+
+ private:
+  mutable std::mutex mutex_;
+};
+
+// Hands out builders that are reset (but keep their internal storage, such as
+// the vtable index) when returned, and recycles the memory of all buffers
+// released from them. Once warmed up, building a message and releasing its
+// buffer does not touch the heap.
+// Any thread may Acquire() a builder, which is then exclusively its own until
+// the lease goes out of scope. The pool must outlive all leases and all
+// buffers released from its builders.
+class BuilderPool {
+ public:
+  class Lease {
+   public:
+    Lease(Lease &&other) : pool_(other.pool_), builder_(other.builder_) {
+      other.builder_ = nullptr;
+    }
+    ~Lease() { if (builder_) pool_->Return(builder_); }
+
+    FlatBufferBuilder &operator*() const { return *builder_; }
+    FlatBufferBuilder *operator->() const { return builder_; }
+    FlatBufferBuilder *get() const { return builder_; }
+
+   private:
+    friend class BuilderPool;
+    Lease(BuilderPool *pool, FlatBufferBuilder *builder)
+      : pool_(pool), builder_(builder) {}
+    Lease(const Lease &);
+    Lease &operator=(const Lease &);
+
+    BuilderPool *pool_;
+    FlatBufferBuilder *builder_;
+  };
+
+  // "initial_size" is the buffer size new builders start with,
+  // "max_cached_bytes" bounds how much released buffer memory is kept.
+  explicit BuilderPool(uoffset_t initial_size = 1024,
+                       size_t max_cached_bytes = 64 * 1024 * 1024)
+    : allocator_(max_cached_bytes), initial_size_(initial_size) {}
+
+  ~BuilderPool() {
+    for (auto it = idle_.begin(); it != idle_.end(); ++it) delete *it;
+  }
+
+  // Get a builder ready for use, creating one if none are idle.
+  Lease Acquire() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!idle_.empty()) {
+        auto builder = idle_.back();
+        idle_.pop_back();
+        return Lease(this, builder);
+      }
+    }
+    return Lease(this, new FlatBufferBuilder(initial_size_, &allocator_));
+  }
+
+  // Number of builders waiting to be acquired.
+  size_t idle() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return idle_.size();
+  }
+
+  // Memory held on to for buffers released by the builders.
+  size_t cached_bytes() const { return allocator_.cached_bytes(); }
+
+ private:
+  void Return(FlatBufferBuilder *builder) {
+    // Reset outside the lock. If the buffer was released, this is where the
+    // builder obtains a new one from the allocator.
+    builder->Clear();
+    std::lock_guard<std::mutex> lock(mutex_);
+    idle_.push_back(builder);
+  }
+
+  BuilderPool(const BuilderPool &);
+  BuilderPool &operator=(const BuilderPool &);
+
+  locked_pooled_allocator allocator_;
+  uoffset_t initial_size_;
+  mutable std::mutex mutex_;
+  std::vector<FlatBufferBuilder *> idle_;
+};
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_BUILDER_POOL_H_
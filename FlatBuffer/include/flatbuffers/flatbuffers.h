@@ -30,6 +30,7 @@
 #include <algorithm>
 #include <functional>
 #include <memory>
+#include <utility>
 
 /// @cond FLATBUFFERS_INTERNAL
 #if __cplusplus <= 199711L && \
@@ -99,6 +100,18 @@
   #define FLATBUFFERS_CONSTEXPR
 #endif
 
+// Hint that memory at an address will be read soon. Prefetches never fault,
+// so any address may be passed.
+#if defined(__GNUC__) || defined(__clang__)
+  #define FLATBUFFERS_PREFETCH(p) __builtin_prefetch(p)
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+  #include <xmmintrin.h>
+  #define FLATBUFFERS_PREFETCH(p) \
+    _mm_prefetch(reinterpret_cast<const char *>(p), _MM_HINT_T0)
+#else
+  #define FLATBUFFERS_PREFETCH(p)
+#endif
+
 /// @endcond
 
 /// @file
@@ -108,10 +121,21 @@ namespace flatbuffers {
 // Our default offset / size type, 32bit on purpose on 64bit systems.
 // Also, using a consistent offset type maintains compatibility of serialized
 // offset values between 32bit and 64bit systems.
+// Defining FLATBUFFERS_64BIT_OFFSETS widens all offsets and sizes to 64bit,
+// which lifts the 2GB limit at the cost of a different (incompatible) binary
+// format. Schemas meant for it mark their root table with (offset64).
+#ifdef FLATBUFFERS_64BIT_OFFSETS
+typedef uint64_t uoffset_t;
+#else
 typedef uint32_t uoffset_t;
+#endif
 
 // Signed offsets for references that can go in both directions.
+#ifdef FLATBUFFERS_64BIT_OFFSETS
+typedef int64_t soffset_t;
+#else
 typedef int32_t soffset_t;
+#endif
 
 // Offset/index used in v-tables, can be changed to uint8_t in
 // format forks to save a bit of space if desired.
@@ -119,7 +143,7 @@ typedef uint16_t voffset_t;
 
 typedef uintmax_t largest_scalar_t;
 
-// In 32bits, this evaluates to 2GB - 1
+// In 32bits, this evaluates to 2GB - 1, in 64bits to 8EB - 1.
 #define FLATBUFFERS_MAX_BUFFER_SIZE ((1ULL << (sizeof(soffset_t) * 8 - 1)) - 1)
 
 // Pointer to relinquished memory.
@@ -293,6 +317,111 @@ private:
   const uint8_t *data_;
 };
 
+// An input iterator over a vector of tables, that prefetches the table
+// 2 * "distance" elements ahead and the vtable "distance" elements ahead.
+// A table is prefetched "distance" steps before its vtable is located, so by
+// then reading its soffset should not stall. See Vector::prefetching_range().
+template<typename T> class PrefetchingVectorIterator {
+ public:
+  typedef typename IndirectHelper<Offset<T>>::return_type return_type;
+
+  PrefetchingVectorIterator(const uint8_t *data, uoffset_t i, uoffset_t size,
+                            uoffset_t distance)
+    : data_(data), i_(i), size_(size), distance_(distance) {}
+
+  bool operator==(const PrefetchingVectorIterator &other) const {
+    return i_ == other.i_;
+  }
+
+  bool operator!=(const PrefetchingVectorIterator &other) const {
+    return i_ != other.i_;
+  }
+
+  return_type operator*() const {
+    return IndirectHelper<Offset<T>>::Read(data_, i_);
+  }
+
+  return_type operator->() const { return **this; }
+
+  PrefetchingVectorIterator &operator++() {
+    i_++;
+    if (distance_) Prefetch(i_);
+    return *this;
+  }
+
+  // Prefetch the first elements of a range starting at the current element,
+  // which the steady state of operator++() doesn't cover.
+  void Prime() const {
+    if (!distance_) return;
+    for (size_t j = i_; j < (std::min)(i_ + 2 * size_t(distance_),
+                                       size_t(size_)); j++) {
+      FLATBUFFERS_PREFETCH(IndirectHelper<Offset<T>>::Read(data_,
+                                                           uoffset_t(j)));
+    }
+  }
+
+ private:
+  void Prefetch(size_t i) const {
+    auto table_ahead = i + 2 * size_t(distance_);
+    if (table_ahead < size_) {
+      FLATBUFFERS_PREFETCH(IndirectHelper<Offset<T>>::Read(
+        data_, uoffset_t(table_ahead)));
+    }
+    auto vtable_ahead = i + distance_;
+    if (vtable_ahead < size_) {
+      auto table = reinterpret_cast<const uint8_t *>(
+        IndirectHelper<Offset<T>>::Read(data_, uoffset_t(vtable_ahead)));
+      FLATBUFFERS_PREFETCH(table - ReadScalar<soffset_t>(table));
+    }
+  }
+
+  const uint8_t *data_;
+  uoffset_t i_;
+  uoffset_t size_;
+  uoffset_t distance_;
+};
+
+// What Vector::prefetching_range() returns, for use in range based for loops.
+template<typename T> class PrefetchingVectorRange {
+ public:
+  typedef PrefetchingVectorIterator<T> iterator;
+
+  PrefetchingVectorRange(const uint8_t *data, uoffset_t size,
+                         uoffset_t distance)
+    : data_(data), size_(size), distance_(distance) {}
+
+  iterator begin() const {
+    iterator it(data_, 0, size_, distance_);
+    it.Prime();
+    return it;
+  }
+
+  iterator end() const { return iterator(data_, size_, size_, distance_); }
+
+ private:
+  const uint8_t *data_;
+  uoffset_t size_;
+  uoffset_t distance_;
+};
+
+// Maps the element type of a vector of tables to the table type.
+template<typename T> struct VectorOfTablesElement {};
+template<typename T> struct VectorOfTablesElement<Offset<T>> {
+  typedef T type;
+};
+
+// The hash of a key in a hash index (see FlatBufferBuilder::CreateHashIndex()),
+// 32 bit FNV-1a, i.e. the same as HashFnv1a<uint32_t>() from hash.h. This is
+// part of the format of such indices, so it must not change.
+inline uint32_t HashIndexKey(const char *key) {
+  uint32_t hash = 2166136261u;
+  for (auto c = key; *c; ++c) {
+    hash ^= static_cast<unsigned char>(*c);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
 // This is used as a helper type for accessing vectors.
 // Vector::data() assumes the vector elements start after the length field.
 template<typename T> class Vector {
@@ -331,6 +460,19 @@ public:
   iterator end() { return iterator(Data(), size()); }
   const_iterator end() const { return const_iterator(Data(), size()); }
 
+  // For vectors of tables only: iterate like begin() / end(), but prefetch
+  // the tables and vtables of elements up to 2 * "distance" ahead, such that
+  // long scans aren't held up by a cache miss on every element:
+  //   for (auto monster : monsters->prefetching_range()) ...
+  // The best distance depends on the work per element, it should cover the
+  // latency of a cache miss. 0 turns prefetching off.
+  template<typename E = T>
+  PrefetchingVectorRange<typename VectorOfTablesElement<E>::type>
+      prefetching_range(uoffset_t distance = 8) const {
+    return PrefetchingVectorRange<typename VectorOfTablesElement<E>::type>(
+      Data(), size(), distance);
+  }
+
   // Change elements if you have a non-const pointer to this object.
   // Scalars only. See reflection.h, and the documentation.
   void Mutate(uoffset_t i, T val) {
@@ -361,16 +503,71 @@ public:
   T *data() { return reinterpret_cast<T *>(Data()); }
 
   template<typename K> return_type LookupByKey(K key) const {
-    void *search_result = std::bsearch(&key, Data(), size(),
-        IndirectHelper<T>::element_stride, KeyCompare<K>);
-
-    if (!search_result) {
-      return nullptr;  // Key not found.
+    uoffset_t n = size();
+    if (!n) return nullptr;
+    // Halve the range without branching on the outcome of each comparison
+    // (which for scalar keys becomes a conditional move), as those branches
+    // are unpredictable by nature. Instead, the tables of both possible next
+    // probes are prefetched, so their cache misses overlap with this one.
+    uoffset_t base = 0;
+    while (n > 1) {
+      auto half = n / 2;
+      PrefetchElement(base + half / 2);
+      PrefetchElement(base + half + half / 2);
+      base = KeyCompare(base + half, key) < 0 ? base + half : base;
+      n -= half;
     }
-
-    const uint8_t *element = reinterpret_cast<const uint8_t *>(search_result);
-
-    return IndirectHelper<T>::Read(element, 0);
+    // "base" is the last element less than the key, or the first element.
+    auto cmp = KeyCompare(base, key);
+    if (cmp < 0 && ++base < size()) cmp = KeyCompare(base, key);
+    return cmp ? nullptr : IndirectHelper<T>::Read(Data(), base);
+  }
+
+  // The same, for vectors written in Eytzinger order (breadth first order of
+  // a balanced binary search tree) by
+  // FlatBufferBuilder::CreateVectorOfEytzingerTables(). The offsets of the
+  // nodes a lookup may visit next are adjacent, so the tables two levels
+  // down can be prefetched while comparing against the current one.
+  template<typename K> return_type LookupByKeyEytzinger(K key) const {
+    size_t n = size();
+    size_t k = 1;
+    while (k <= n) {
+      // The 4 grandchildren of a node are adjacent, prefetch their tables.
+      for (size_t c = 4 * k; c < 4 * k + 4 && c <= n; c++) {
+        PrefetchElement(static_cast<uoffset_t>(c - 1));
+      }
+      k = 2 * k + (KeyCompare(static_cast<uoffset_t>(k - 1), key) < 0);
+    }
+    // Undo the steps right taken after the last step left, which was taken
+    // at the smallest element not less than the key.
+    while (k & 1) k >>= 1;
+    k >>= 1;
+    if (!k || KeyCompare(static_cast<uoffset_t>(k - 1), key)) return nullptr;
+    return IndirectHelper<T>::Read(Data(), static_cast<uoffset_t>(k - 1));
+  }
+
+  // The same as LookupByKey(), for vectors of tables with a string key, but
+  // in constant time through a hash index created for this vector by
+  // FlatBufferBuilder::CreateHashIndex(). Without an index (e.g. for buffers
+  // written before the index was added to the schema), "index" is nullptr
+  // and this falls back to LookupByKey().
+  return_type LookupByKeyHashed(const char *key,
+                                const Vector<uint32_t> *index) const {
+    auto slots = index ? index->size() : 0;
+    auto mask = slots - 1;
+    if (!slots || (slots & mask)) return LookupByKey(key);
+    // Linear probing, from the slot of the hash of the key up to the first
+    // empty one. Slots hold element indices plus 1, 0 is empty. Probing is
+    // bounded and indices checked, such that any verified buffer is safe.
+    auto slot = HashIndexKey(key) & mask;
+    for (uoffset_t probes = 0; probes < slots; probes++) {
+      auto entry = index->Get(slot);
+      if (!entry) break;
+      if (entry <= size() && !KeyCompare(entry - 1, key))
+        return IndirectHelper<T>::Read(Data(), entry - 1);
+      slot = (slot + 1) & mask;
+    }
+    return nullptr;
   }
 
 protected:
@@ -381,14 +578,12 @@ protected:
   uoffset_t length_;
 
 private:
-  template<typename K> static int KeyCompare(const void *ap, const void *bp) {
-    const K *key = reinterpret_cast<const K *>(ap);
-    const uint8_t *data = reinterpret_cast<const uint8_t *>(bp);
-    auto table = IndirectHelper<T>::Read(data, 0);
+  void PrefetchElement(uoffset_t i) const {
+    FLATBUFFERS_PREFETCH(IndirectHelper<T>::Read(Data(), i));
+  }
 
-    // std::bsearch compares with the operands transposed, so we negate the
-    // result here.
-    return -table->KeyCompareWithValue(*key);
+  template<typename K> int KeyCompare(uoffset_t i, const K &key) const {
+    return IndirectHelper<T>::Read(Data(), i)->KeyCompareWithValue(key);
   }
 };
 
@@ -432,8 +627,203 @@ class simple_allocator {
   virtual ~simple_allocator() {}
   virtual uint8_t *allocate(size_t size) const { return new uint8_t[size]; }
   virtual void deallocate(uint8_t *p) const { delete[] p; }
+
+  // Grow the block at "old_p" from "old_size" to "new_size" bytes, such that
+  // the last "in_use_back" bytes of the old block end up at the end of the
+  // returned block (vector_downward fills its buffer from the back).
+  // The default allocates a new block and copies, override this if your
+  // allocator can do better, e.g. by extending a block downwards in place.
+  virtual uint8_t *reallocate_downward(uint8_t *old_p, size_t old_size,
+                                       size_t new_size,
+                                       size_t in_use_back) const {
+    assert(new_size > old_size && in_use_back <= old_size);
+    auto new_p = allocate(new_size);
+    memcpy(new_p + new_size - in_use_back, old_p + old_size - in_use_back,
+           in_use_back);
+    deallocate(old_p);
+    return new_p;
+  }
 };
 
+// The allocator used when none is specified. It is stateless and never
+// destroyed, so buffers released with it may outlive their builder.
+inline const simple_allocator &DefaultAllocator() {
+  static simple_allocator allocator;
+  return allocator;
+}
+
+// Allocator that hands out blocks from a single region of memory supplied by
+// the caller (e.g. a large static array, or an mmap-ed region of which only
+// the touched pages get committed).
+// Blocks are handed out from the top of the region downwards, which means
+// the most recently allocated block can be grown downwards in place, so a
+// FlatBufferBuilder using it never copies its data when growing.
+// Individual blocks are not reclaimed, call reset() once none of the blocks
+// are in use anymore. If the region runs out, it falls back to the heap.
+// Not thread-safe, use one per builder or per thread.
+class arena_allocator : public simple_allocator {
+ public:
+  arena_allocator(uint8_t *region, size_t region_size)
+    : region_(region), region_end_(region + region_size) {
+    reset();
+  }
+
+  uint8_t *allocate(size_t size) const {
+    if (size > static_cast<size_t>(top_ - region_))
+      return simple_allocator::allocate(size);
+    last_ = top_ - size;
+    top_ = AlignDown(last_);
+    return last_;
+  }
+
+  void deallocate(uint8_t *p) const {
+    if (!InRegion(p)) simple_allocator::deallocate(p);
+  }
+
+  uint8_t *reallocate_downward(uint8_t *old_p, size_t old_size,
+                               size_t new_size, size_t in_use_back) const {
+    auto grow = new_size - old_size;
+    if (old_p == last_ && grow <= static_cast<size_t>(old_p - region_)) {
+      // Most recent block: extend it downwards, the data stays where it is.
+      last_ = old_p - grow;
+      top_ = AlignDown(last_);
+      return last_;
+    }
+    return simple_allocator::reallocate_downward(old_p, old_size, new_size,
+                                                 in_use_back);
+  }
+
+  // Make the whole region available again.
+  void reset() {
+    top_ = AlignDown(region_end_);
+    last_ = nullptr;
+  }
+
+  // How much of the region is currently handed out.
+  size_t used() const { return static_cast<size_t>(region_end_ - top_); }
+
+ private:
+  // Keep the end of every block aligned, since vector_downward aligns
+  // relative to the end of its buffer.
+  uint8_t *AlignDown(uint8_t *p) const {
+    auto align = AlignOf<largest_scalar_t>();
+    return p - (reinterpret_cast<size_t>(p) & (align - 1));
+  }
+
+  bool InRegion(const uint8_t *p) const {
+    return p >= region_ && p < region_end_;
+  }
+
+  uint8_t *region_;
+  uint8_t *region_end_;
+  mutable uint8_t *top_;   // Everything above this is handed out.
+  mutable uint8_t *last_;  // The most recently allocated block.
+};
+
+// Allocator that keeps deallocated blocks around (bucketed by power of 2
+// size) and hands them out again, such that a builder that is repeatedly
+// used to create similarly sized buffers stops hitting the heap.
+// "max_cached_bytes" limits how much memory is kept around.
+// Not thread-safe, use one per builder or per thread.
+class pooled_allocator : public simple_allocator {
+ public:
+  explicit pooled_allocator(size_t max_cached_bytes = 16 * 1024 * 1024)
+    : max_cached_bytes_(max_cached_bytes), cached_bytes_(0) {}
+
+  ~pooled_allocator() {
+    for (size_t i = 0; i < kNumBuckets; i++) {
+      for (auto it = free_[i].begin(); it != free_[i].end(); ++it)
+        delete[] *it;
+    }
+  }
+
+  uint8_t *allocate(size_t size) const {
+    auto bucket = Bucket(size);
+    uint8_t *block;
+    if (bucket < kNumBuckets && !free_[bucket].empty()) {
+      block = free_[bucket].back();
+      free_[bucket].pop_back();
+      cached_bytes_ -= BucketSize(bucket);
+    } else {
+      block = new uint8_t[kHeaderSize +
+                          (bucket < kNumBuckets ? BucketSize(bucket) : size)];
+      WriteScalar(block, static_cast<uint64_t>(bucket));
+    }
+    return block + kHeaderSize;
+  }
+
+  void deallocate(uint8_t *p) const {
+    auto block = p - kHeaderSize;
+    auto bucket = static_cast<size_t>(ReadScalar<uint64_t>(block));
+    if (bucket < kNumBuckets &&
+        cached_bytes_ + BucketSize(bucket) <= max_cached_bytes_) {
+      free_[bucket].push_back(block);
+      cached_bytes_ += BucketSize(bucket);
+    } else {
+      delete[] block;
+    }
+  }
+
+  // How much memory is currently held on to for reuse.
+  size_t cached_bytes() const { return cached_bytes_; }
+
+ private:
+  // Blocks start with a header holding their bucket, sized such that the
+  // block itself stays aligned.
+  static const size_t kHeaderSize = 16;
+  static const size_t kMinBucketBits = 6;  // 64 bytes.
+  // Sizes up to 2^37 bytes, or up to 2^31 where size_t is 32 bits, so the
+  // largest bucket size still fits in a size_t.
+  static const size_t kNumBuckets =
+    sizeof(size_t) * 8 - kMinBucketBits < 32
+      ? sizeof(size_t) * 8 - kMinBucketBits
+      : 32;
+
+  static size_t BucketSize(size_t bucket) {
+    return static_cast<size_t>(1) << (bucket + kMinBucketBits);
+  }
+
+  static size_t Bucket(size_t size) {
+    size_t bucket = 0;
+    while (bucket < kNumBuckets && BucketSize(bucket) < size) bucket++;
+    return bucket;
+  }
+
+  size_t max_cached_bytes_;
+  mutable size_t cached_bytes_;
+  mutable std::vector<uint8_t *> free_[kNumBuckets];
+};
+
+// A contiguous part of a buffer that was built in segments, see
+// FlatBufferBuilder::SetSegmentSize(). Layout compatible with POSIX iovec
+// on common platforms, but don't rely on it.
+struct BufferSegment {
+  const uint8_t *data;
+  size_t size;
+};
+
+// Counters of the work done by a FlatBufferBuilder since it was constructed
+// or last cleared, see FlatBufferBuilder::GetStats(). They are only counted
+// if FLATBUFFERS_BUILDER_STATS is defined (for all code using FlatBuffers),
+// otherwise counting compiles to nothing and they stay 0.
+struct BuilderStats {
+  size_t reallocations;  // Times the buffer grew, or a segment was started.
+  size_t bytes_moved;  // Bytes copied to new memory by the above.
+  size_t vtables_reused;  // Tables that share a vtable written earlier.
+  size_t vtables_written;  // Tables that needed a new vtable.
+  size_t shared_strings_reused;  // CreateSharedString() calls that found one.
+  size_t shared_strings_written;  // CreateSharedString() calls that didn't.
+  size_t shared_tables_reused;  // EndSharedTable() calls that found one.
+  size_t padding_bytes;  // Bytes added for alignment.
+  size_t buffer_size;  // Current size of the buffer, see GetSize().
+};
+
+#ifdef FLATBUFFERS_BUILDER_STATS
+  #define FLATBUFFERS_BUILDER_STAT(X) X
+#else
+  #define FLATBUFFERS_BUILDER_STAT(X)
+#endif
+
 // This is a minimal replication of std::vector<uint8_t> functionality,
 // except growing from higher to lower addresses. i.e push_back() inserts data
 // in the lowest address in the vector.
@@ -444,27 +834,85 @@ class vector_downward {
     : reserved_(initial_size),
       buf_(allocator.allocate(reserved_)),
       cur_(buf_ + reserved_),
-      allocator_(allocator) {
+      allocator_(allocator),
+      segment_size_(0),
+      base_(0),
+      object_start_(kNoObject),
+      reallocations_(0),
+      bytes_moved_(0) {
     assert((initial_size & (sizeof(largest_scalar_t) - 1)) == 0);
   }
 
   ~vector_downward() {
+    clear_chunks();
     if (buf_)
       allocator_.deallocate(buf_);
   }
 
   void clear() {
+    clear_chunks();
+    // Drop any slack new_segment() left at the end of the allocation.
+    reserved_ &= ~(AlignOf<largest_scalar_t>() - 1);
     if (buf_ == nullptr)
       buf_ = allocator_.allocate(reserved_);
 
     cur_ = buf_ + reserved_;
+    object_start_ = kNoObject;
+    reallocations_ = 0;
+    bytes_moved_ = 0;
+  }
+
+  size_t reallocations() const { return reallocations_; }
+  size_t bytes_moved() const { return bytes_moved_; }
+
+  // Once the current allocation is full, continue in a new one of (at least)
+  // "segment_size" bytes instead of growing it. 0 to disable.
+  // Can only be changed while empty.
+  void set_segment_size(size_t segment_size) {
+    assert(size() == 0);
+    auto largest_align = AlignOf<largest_scalar_t>();
+    segment_size_ = (segment_size + (largest_align - 1)) & ~(largest_align - 1);
+  }
+
+  // Bytes pushed from begin_object() up to end_object() (a table and its
+  // vtable, a vector or a string) will be contiguous in memory, even when
+  // the buffer is segmented.
+  // An object that is already open is extended rather than restarted, such
+  // that padding pushed ahead of it can be made part of it.
+  void begin_object() {
+    if (object_start_ == kNoObject) object_start_ = size();
+  }
+  void end_object() { object_start_ = kNoObject; }
+
+  // Whether all data lives in a single allocation, i.e. data() points to
+  // the entire buffer.
+  bool contiguous() const { return chunks_.empty(); }
+
+  // The buffer contents in memory order, i.e. starting with data().
+  std::vector<BufferSegment> segments() const {
+    std::vector<BufferSegment> segs;
+    segs.reserve(chunks_.size() + 1);
+    BufferSegment cur = { cur_, size() - base_ };
+    segs.push_back(cur);
+    for (auto it = chunks_.rbegin(); it != chunks_.rend(); ++it) {
+      BufferSegment seg = { it->end - it->size, it->size };
+      segs.push_back(seg);
+    }
+    return segs;
   }
 
   // Relinquish the pointer to the caller.
   unique_ptr_t release() {
+    // A segmented buffer can only be released if it ended up in one piece.
+    assert(contiguous());
     // Actually deallocate from the start of the allocated memory.
+    // Refer to the allocator rather than copying it, which would slice off
+    // any derived allocator. Capturing just two pointers also lets
+    // std::function store the deleter without allocating.
+    auto allocator = &allocator_;
+    auto buf = buf_;
     std::function<void(uint8_t *)> deleter(
-      std::bind(&simple_allocator::deallocate, allocator_, buf_));
+      [allocator, buf](uint8_t *) { allocator->deallocate(buf); });
 
     // Point to the desired offset.
     unique_ptr_t retval(data(), deleter);
@@ -482,17 +930,7 @@ class vector_downward {
 
   uint8_t *make_space(size_t len) {
     if (len > static_cast<size_t>(cur_ - buf_)) {
-      auto old_size = size();
-      auto largest_align = AlignOf<largest_scalar_t>();
-      reserved_ += (std::max)(len, growth_policy(reserved_));
-      // Round up to avoid undefined behavior from unaligned loads and stores.
-      reserved_ = (reserved_ + (largest_align - 1)) & ~(largest_align - 1);
-      auto new_buf = allocator_.allocate(reserved_);
-      auto new_cur = new_buf + reserved_ - old_size;
-      memcpy(new_cur, cur_, old_size);
-      cur_ = new_cur;
-      allocator_.deallocate(buf_);
-      buf_ = new_buf;
+      if (segment_size_) new_segment(len); else grow(len);
     }
     cur_ -= len;
     // Beyond this, signed offsets may not have enough range:
@@ -501,9 +939,16 @@ class vector_downward {
     return cur_;
   }
 
+  // Make room for "len" more bytes up front, such that make_space() won't
+  // have to grow the buffer until they're used up. Segmented buffers don't
+  // grow, so they ignore this.
+  void ensure_space(size_t len) {
+    if (len > static_cast<size_t>(cur_ - buf_) && !segment_size_) grow(len);
+  }
+
   uoffset_t size() const {
     assert(cur_ != nullptr && buf_ != nullptr);
-    return static_cast<uoffset_t>(reserved_ - (cur_ - buf_));
+    return static_cast<uoffset_t>(base_ + reserved_ - (cur_ - buf_));
   }
 
   uint8_t *data() const {
@@ -511,7 +956,11 @@ class vector_downward {
     return cur_;
   }
 
-  uint8_t *data_at(size_t offset) const { return buf_ + reserved_ - offset; }
+  uint8_t *data_at(size_t offset) const {
+    if (offset > base_ || chunks_.empty())
+      return buf_ + reserved_ - (offset - base_);
+    return chunk_data_at(offset);
+  }
 
   // push() & fill() are most frequently called with small byte counts (<= 4),
   // which is why we're using loops rather than calling memcpy/memset.
@@ -525,17 +974,173 @@ class vector_downward {
     for (size_t i = 0; i < zero_pad_bytes; i++) dest[i] = 0;
   }
 
-  void pop(size_t bytes_to_remove) { cur_ += bytes_to_remove; }
+  void pop(size_t bytes_to_remove) {
+    assert(bytes_to_remove <= static_cast<size_t>(buf_ + reserved_ - cur_));
+    cur_ += bytes_to_remove;
+  }
 
  private:
   // You shouldn't really be copying instances of this class.
   vector_downward(const vector_downward &);
   vector_downward &operator=(const vector_downward &);
 
+  // A full allocation of a segmented buffer, holding the bytes at offsets
+  // (base, base + size], which end at "end".
+  struct chunk {
+    uint8_t *buf;
+    uint8_t *end;
+    size_t base;
+    size_t size;
+  };
+
+  static const size_t kNoObject = static_cast<size_t>(-1);
+
+  // Grow the (contiguous) buffer such that at least "len" bytes are free.
+  void grow(size_t len) {
+    auto old_size = size();
+    auto old_reserved = reserved_;
+    auto largest_align = AlignOf<largest_scalar_t>();
+    reserved_ += (std::max)(len, growth_policy(reserved_));
+    // Round up to avoid undefined behavior from unaligned loads and stores.
+    reserved_ = (reserved_ + (largest_align - 1)) & ~(largest_align - 1);
+    FLATBUFFERS_BUILDER_STAT(auto old_cur = cur_;)
+    buf_ = allocator_.reallocate_downward(buf_, old_reserved, reserved_,
+                                          old_size);
+    cur_ = buf_ + reserved_ - old_size;
+    // Allocators that grow in place don't move the data.
+    FLATBUFFERS_BUILDER_STAT(
+      reallocations_++;
+      if (cur_ != old_cur) bytes_moved_ += old_size;
+    )
+  }
+
+  // Continue a segmented buffer in a new allocation with room for "len"
+  // bytes. Any part of the currently open object is moved along, such that
+  // no object is split between chunks. The chunk ends a few bytes short of
+  // the end of the allocation, such that alignment is the same in every
+  // chunk.
+  void new_segment(size_t len) {
+    auto largest_align = AlignOf<largest_scalar_t>();
+    auto total = static_cast<size_t>(size());
+    auto keep = (std::min)(object_start_, total);
+    auto carried = total - keep;
+    auto slack = keep & (largest_align - 1);
+    auto needed = carried + len + slack;
+    // Objects larger than a segment get a chunk of their own, with room to
+    // spare to avoid moving them again and again while they grow.
+    auto new_reserved = needed > segment_size_ ? needed * 2 : segment_size_;
+    new_reserved = (new_reserved + (largest_align - 1)) & ~(largest_align - 1);
+    auto new_buf = allocator_.allocate(new_reserved);
+    new_reserved -= slack;
+    memcpy(new_buf + new_reserved - carried, cur_, carried);
+    FLATBUFFERS_BUILDER_STAT(reallocations_++; bytes_moved_ += carried;)
+    if (keep > base_) {
+      chunk c = { buf_, buf_ + reserved_, base_, keep - base_ };
+      chunks_.push_back(c);
+      base_ = keep;
+    } else {
+      // Nothing left behind.
+      allocator_.deallocate(buf_);
+    }
+    buf_ = new_buf;
+    reserved_ = new_reserved;
+    cur_ = buf_ + reserved_ - carried;
+  }
+
+  uint8_t *chunk_data_at(size_t offset) const {
+    // Find the last chunk starting below offset.
+    size_t lo = 0, hi = chunks_.size();
+    while (hi - lo > 1) {
+      auto mid = (lo + hi) / 2;
+      if (chunks_[mid].base < offset) lo = mid; else hi = mid;
+    }
+    auto &c = chunks_[lo];
+    return c.end - (offset - c.base);
+  }
+
+  void clear_chunks() {
+    for (auto it = chunks_.begin(); it != chunks_.end(); ++it)
+      allocator_.deallocate(it->buf);
+    chunks_.clear();
+    base_ = 0;
+  }
+
   size_t reserved_;
   uint8_t *buf_;
   uint8_t *cur_;  // Points at location between empty (below) and used (above).
   const simple_allocator &allocator_;
+  size_t segment_size_;  // 0 if not segmented.
+  std::vector<chunk> chunks_;  // Full allocations, oldest first.
+  size_t base_;  // Amount of data in chunks_.
+  size_t object_start_;  // Size at begin_object(), or kNoObject.
+  size_t reallocations_;  // See BuilderStats.
+  size_t bytes_moved_;
+};
+
+// Open addressing hash table of offsets to objects in a buffer being built,
+// keyed by a hash of their contents. Lets the builder find duplicate vtables
+// and strings without comparing against all of them, and without allocating
+// per entry. The objects themselves are compared by the caller.
+class offset_hash_set {
+ public:
+  offset_hash_set() : count_(0) {}
+
+  // Returns the offset of an object with the given hash for which
+  // "equal(offset)" is true, or 0.
+  template<typename F> uoffset_t find(uint32_t hash, F equal) const {
+    if (entries_.empty()) return 0;
+    auto mask = entries_.size() - 1;
+    // Linear probing, the table is never more than half full.
+    for (auto i = hash & mask; entries_[i].offset; i = (i + 1) & mask) {
+      auto &e = entries_[i];
+      if (e.hash == hash && equal(e.offset)) return e.offset;
+    }
+    return 0;
+  }
+
+  void insert(uoffset_t offset, uint32_t hash) {
+    if ((count_ + 1) * 2 > entries_.size()) {
+      // Grow (or create) the table, and rehash the existing entries.
+      std::vector<entry> old_entries(
+        (std::max)(entries_.size() * 2, static_cast<size_t>(16)));
+      old_entries.swap(entries_);
+      count_ = 0;
+      for (auto it = old_entries.begin(); it != old_entries.end(); ++it) {
+        if (it->offset) insert(it->offset, it->hash);
+      }
+    }
+    auto mask = entries_.size() - 1;
+    auto i = hash & mask;
+    while (entries_[i].offset) i = (i + 1) & mask;
+    entries_[i].hash = hash;
+    entries_[i].offset = offset;
+    count_++;
+  }
+
+  // Forget all entries, but keep the storage for reuse.
+  void clear() {
+    std::fill(entries_.begin(), entries_.end(), entry());
+    count_ = 0;
+  }
+
+  size_t size() const { return count_; }
+
+  // Calls "f(offset, hash)" for all entries.
+  template<typename F> void for_each(F f) const {
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+      if (it->offset) f(it->offset, it->hash);
+    }
+  }
+
+ private:
+  struct entry {
+    entry() : hash(0), offset(0) {}
+    uint32_t hash;
+    uoffset_t offset;  // 0 for an empty slot.
+  };
+
+  std::vector<entry> entries_;  // Size is always a power of 2.
+  size_t count_;
 };
 
 // Converts a Field ID to a virtual table offset.
@@ -551,8 +1156,146 @@ inline voffset_t FieldIndexToOffset(voffset_t field_id) {
 inline size_t PaddingBytes(size_t buf_size, size_t scalar_size) {
   return ((~buf_size) + 1) & (scalar_size - 1);
 }
+
+// FNV-1a over a range of bytes. Used to index serialized data (such as
+// vtables) by content, see hash.h for the general purpose variants.
+// Pass the hash of preceding bytes as "hash" to hash several ranges as one.
+inline uint32_t HashBytes(const uint8_t *bytes, size_t len,
+                          uint32_t hash = 0x811C9DC5) {
+  for (size_t i = 0; i < len; i++) {
+    hash ^= bytes[i];
+    hash *= 0x01000193;
+  }
+  return hash;
+}
 /// @endcond
 
+// Upper bounds on the number of bytes objects take up in a buffer, including
+// alignment padding, for use with FlatBufferBuilder::Reserve().
+// The generated code has a <Table>SizeBound() function for each table.
+
+// A string of "len" bytes: length field, contents and 0 terminator.
+inline size_t StringSizeBound(size_t len) {
+  return sizeof(uoffset_t) + len + 1 + (sizeof(uoffset_t) - 1);
+}
+
+// A vector of "len" elements, which are scalars, offsets or structs.
+inline size_t VectorSizeBound(size_t len, size_t elemsize, size_t alignment) {
+  return sizeof(uoffset_t) + len * elemsize +
+         ((std::max)(alignment, sizeof(uoffset_t)) - 1);
+}
+
+// What Finish() adds: root offset, file identifier and alignment (assuming
+// no force_align beyond the largest scalar).
+inline size_t FinishSizeBound() {
+  return sizeof(uoffset_t) + 4 + (sizeof(largest_scalar_t) - 1);
+}
+
+/// @cond FLATBUFFERS_INTERNAL
+// Helpers for sorting tables by key, see
+// FlatBufferBuilder::CreateVectorOfSortedTables().
+
+// Maps scalar keys to unsigned integers with the same order.
+template<typename T> uint64_t SortableKey(T key) {
+  static_assert(std::is_integral<T>::value, "T must be an integral type");
+  // Flip the sign bit, such that negative numbers come first.
+  return std::is_signed<T>::value
+    ? static_cast<uint64_t>(static_cast<int64_t>(key)) ^ (1ULL << 63)
+    : static_cast<uint64_t>(key);
+}
+
+inline uint64_t SortableKey(double key) {
+  if (key == 0) key = 0;  // -0.0 compares equal to 0.0.
+  uint64_t bits;
+  memcpy(&bits, &key, sizeof(bits));
+  // Positive numbers: set the sign bit to come after negative ones.
+  // Negative numbers: flip all bits, such that larger magnitudes come first.
+  return bits & (1ULL << 63) ? ~bits : bits | (1ULL << 63);
+}
+
+inline uint64_t SortableKey(float key) {
+  return SortableKey(static_cast<double>(key));
+}
+
+struct KeyedOffset {
+  uint64_t key;
+  uoffset_t offset;
+};
+
+// Stable LSD radix sort by key, one byte at a time. Bytes that are the same
+// for all keys (such as the upper bytes of small numbers) are skipped.
+inline void RadixSortByKey(std::vector<KeyedOffset> &entries) {
+  if (entries.size() < 64) {
+    std::stable_sort(entries.begin(), entries.end(),
+      [](const KeyedOffset &a, const KeyedOffset &b) { return a.key < b.key; });
+    return;
+  }
+  size_t counts[sizeof(uint64_t)][256];
+  memset(counts, 0, sizeof(counts));
+  for (auto it = entries.begin(); it != entries.end(); ++it) {
+    for (size_t b = 0; b < sizeof(uint64_t); b++)
+      counts[b][(it->key >> (b * 8)) & 0xFF]++;
+  }
+  std::vector<KeyedOffset> scratch(entries.size());
+  for (size_t b = 0; b < sizeof(uint64_t); b++) {
+    auto &count = counts[b];
+    if (count[(entries[0].key >> (b * 8)) & 0xFF] == entries.size()) continue;
+    size_t pos = 0;
+    for (size_t i = 0; i < 256; i++) {
+      auto c = count[i];
+      count[i] = pos;
+      pos += c;
+    }
+    for (auto it = entries.begin(); it != entries.end(); ++it)
+      scratch[count[(it->key >> (b * 8)) & 0xFF]++] = *it;
+    entries.swap(scratch);
+  }
+}
+
+// The first 8 bytes of a string (up to its terminator) as a big endian
+// number, such that comparing these orders like strcmp does.
+inline uint64_t StringKeyPrefix(const char *str) {
+  uint64_t prefix = 0;
+  size_t i = 0;
+  for (; i < sizeof(uint64_t) && str[i]; i++)
+    prefix = (prefix << 8) | static_cast<uint8_t>(str[i]);
+  return i ? prefix << (8 * (sizeof(uint64_t) - i)) : 0;
+}
+
+struct StringKeyedOffset {
+  uint64_t prefix;
+  const char *key;
+  uoffset_t offset;
+
+  bool operator<(const StringKeyedOffset &o) const {
+    if (prefix != o.prefix) return prefix < o.prefix;
+    // Equal prefixes with a terminator in them means equal strings.
+    if (!(prefix & 0xFF)) return false;
+    return strcmp(key + sizeof(uint64_t), o.key + sizeof(uint64_t)) < 0;
+  }
+};
+/// @endcond
+
+// A string along with its hash, for FlatBufferBuilder::CreateSharedString().
+// Keep these around (e.g. in a static table of commonly used strings) to
+// hash each string only once rather than every time it is stored.
+// Does not copy the string, which must outlive this.
+struct PrehashedString {
+  PrehashedString(const char *_str, size_t _len)
+    : str(_str), len(_len),
+      hash(HashBytes(reinterpret_cast<const uint8_t *>(_str), _len)) {}
+  explicit PrehashedString(const char *_str)
+    : str(_str), len(strlen(_str)),
+      hash(HashBytes(reinterpret_cast<const uint8_t *>(str), len)) {}
+  explicit PrehashedString(const std::string &_str)
+    : str(_str.c_str()), len(_str.length()),
+      hash(HashBytes(reinterpret_cast<const uint8_t *>(str), len)) {}
+
+  const char *str;
+  size_t len;
+  uint32_t hash;
+};
+
 /// @addtogroup flatbuffers_cpp_api
 /// @{
 /// @class FlatBufferBuilder
@@ -572,20 +1315,17 @@ FLATBUFFERS_FINAL_CLASS
   /// @param[in] initial_size The initial size of the buffer, in bytes. Defaults
   /// to`1024`.
   /// @param[in] allocator A pointer to the `simple_allocator` that should be
-  /// used. Defaults to `nullptr`, which means the `default_allocator` will be
-  /// be used.
+  /// used. Defaults to `nullptr`, which means the `DefaultAllocator()` will
+  /// be used. A custom allocator must outlive any buffer released from this
+  /// builder.
   explicit FlatBufferBuilder(uoffset_t initial_size = 1024,
                              const simple_allocator *allocator = nullptr)
-      : buf_(initial_size, allocator ? *allocator : default_allocator),
-        nested(false), finished(false), minalign_(1), force_defaults_(false),
-        string_pool(nullptr) {
+      : buf_(initial_size, allocator ? *allocator : DefaultAllocator()),
+        nested(false), finished(false), minalign_(1),
+        force_defaults_(false), shared_table_start_(0) {
     offsetbuf_.reserve(16);  // Avoid first few reallocs.
-    vtables_.reserve(16);
     EndianCheck();
-  }
-
-  ~FlatBufferBuilder() {
-    if (string_pool) delete string_pool;
+    memset(&stats_, 0, sizeof(stats_));
   }
 
   /// @brief Reset all the state in this FlatBufferBuilder so it can be reused
@@ -595,27 +1335,85 @@ FLATBUFFERS_FINAL_CLASS
     offsetbuf_.clear();
     nested = false;
     finished = false;
+    // Keep the hash table storage around for the next buffer.
     vtables_.clear();
     minalign_ = 1;
-    if (string_pool) string_pool->clear();
+    string_pool_.clear();
+    table_pool_.clear();
+    offset_stack_.clear();
+    memset(&stats_, 0, sizeof(stats_));
+  }
+
+  /// @brief Get counters of the work done since construction or the last
+  /// `Clear()`, e.g. to tune the initial size. These are all 0 (except for
+  /// `buffer_size`) unless `FLATBUFFERS_BUILDER_STATS` is defined.
+  BuilderStats GetStats() const {
+    auto stats = stats_;
+    stats.reallocations = buf_.reallocations();
+    stats.bytes_moved = buf_.bytes_moved();
+    stats.buffer_size = GetSize();
+    return stats;
   }
 
   /// @brief The current size of the serialized buffer, counting from the end.
   /// @return Returns an `uoffset_t` with the current size of the buffer.
   uoffset_t GetSize() const { return buf_.size(); }
 
+  /// @brief Make sure `size` more bytes can be added without the buffer
+  /// having to grow. Use this with the bounds from the generated
+  /// `<Table>SizeBound()` functions (and `StringSizeBound()` etc.) to
+  /// allocate once for a whole buffer.
+  /// @param[in] size The number of bytes about to be added.
+  void Reserve(size_t size) { buf_.ensure_space(size); }
+
   /// @brief Get the serialized buffer (after you call `Finish()`).
   /// @return Returns an `uint8_t` pointer to the FlatBuffer data inside the
   /// buffer.
   uint8_t *GetBufferPointer() const {
     Finished();
+    // If this asserts, the buffer was built in segments, see
+    // GetBufferSegments().
+    assert(buf_.contiguous());
     return buf_.data();
   }
 
   /// @brief Get a pointer to an unfinished buffer.
-  /// @return Returns a `uint8_t` pointer to the unfinished buffer.
+  /// @return Returns a `uint8_t` pointer to the unfinished buffer (only the
+  /// first segment of it if built in segments).
   uint8_t *GetCurrentBufferPointer() const { return buf_.data(); }
 
+  /// @brief Build the buffer in a chain of separate allocations of (at least)
+  /// `segment_size` bytes, rather than in a single one that is reallocated
+  /// and copied as it grows. Must be called before adding any data.
+  /// Tables, vectors and strings are never split between segments.
+  /// @param[in] segment_size The allocation size for segments after the
+  /// first (which has the size passed to the constructor), or 0 to go back
+  /// to a contiguous buffer.
+  void SetSegmentSize(size_t segment_size) {
+    buf_.set_segment_size(segment_size);
+  }
+
+  /// @brief Get the serialized buffer (after you call `Finish()`) as a list
+  /// of segments, suitable for e.g. `writev`. This also works when not
+  /// building in segments, in which case there is just one.
+  /// @return A vector of memory ranges, which together form the buffer.
+  std::vector<BufferSegment> GetBufferSegments() const {
+    Finished();
+    return buf_.segments();
+  }
+
+  /// @brief Copy the serialized buffer (after you call `Finish()`) into
+  /// contiguous memory, for when it was built in segments.
+  /// @param[out] dest Where to copy to, must have room for `GetSize()` bytes.
+  void CopyBufferTo(uint8_t *dest) const {
+    Finished();
+    auto segs = buf_.segments();
+    for (auto it = segs.begin(); it != segs.end(); ++it) {
+      memcpy(dest, it->data, it->size);
+      dest += it->size;
+    }
+  }
+
   /// @brief Get the released pointer to the serialized buffer.
   /// @warning Do NOT attempt to use this FlatBufferBuilder afterwards!
   /// @return The `unique_ptr` returned has a special allocator that knows how
@@ -648,7 +1446,9 @@ FLATBUFFERS_FINAL_CLASS
 
   void Align(size_t elem_size) {
     if (elem_size > minalign_) minalign_ = elem_size;
-    buf_.fill(PaddingBytes(buf_.size(), elem_size));
+    auto padding = PaddingBytes(buf_.size(), elem_size);
+    buf_.fill(padding);
+    FLATBUFFERS_BUILDER_STAT(stats_.padding_bytes += padding;)
   }
 
   void PushFlatBuffer(const uint8_t *bytes, size_t size) {
@@ -743,6 +1543,7 @@ FLATBUFFERS_FINAL_CLASS
   uoffset_t StartTable() {
     NotNested();
     nested = true;
+    buf_.begin_object();
     return GetSize();
   }
 
@@ -773,22 +1574,21 @@ FLATBUFFERS_FINAL_CLASS
       WriteScalar<voffset_t>(buf_.data() + field_location->id, pos);
     }
     offsetbuf_.clear();
-    auto vt1 = reinterpret_cast<voffset_t *>(buf_.data());
+    auto vt1 = buf_.data();
     auto vt1_size = ReadScalar<voffset_t>(vt1);
+    auto vt1_hash = HashBytes(vt1, vt1_size);
     auto vt_use = GetSize();
     // See if we already have generated a vtable with this exact same
     // layout before. If so, make it point to the old one, remove this one.
-    for (auto it = vtables_.begin(); it != vtables_.end(); ++it) {
-      auto vt2 = reinterpret_cast<voffset_t *>(buf_.data_at(*it));
-      auto vt2_size = *vt2;
-      if (vt1_size != vt2_size || memcmp(vt2, vt1, vt1_size)) continue;
-      vt_use = *it;
+    auto vt2 = FindVTable(vt1, vt1_size, vt1_hash);
+    if (vt2) {
+      vt_use = vt2;
       buf_.pop(GetSize() - vtableoffsetloc);
-      break;
-    }
-    // If this is a new vtable, remember it.
-    if (vt_use == GetSize()) {
-      vtables_.push_back(vt_use);
+      FLATBUFFERS_BUILDER_STAT(stats_.vtables_reused++;)
+    } else {
+      // This is a new vtable, remember it.
+      AddVTable(vt_use, vt1_hash);
+      FLATBUFFERS_BUILDER_STAT(stats_.vtables_written++;)
     }
     // Fill the vtable offset we created above.
     // The offset points from the beginning of the object to where the
@@ -800,15 +1600,141 @@ FLATBUFFERS_FINAL_CLASS
                   static_cast<soffset_t>(vtableoffsetloc));
 
     nested = false;
+    buf_.end_object();
     return vtableoffsetloc;
   }
 
+  // Tables that may turn out to be duplicates, used by the generated
+  // CreateShared<Table>() functions: call StartSharedTable() with the largest
+  // alignment of the fields, then StartTable(), add the fields, and finish
+  // with EndSharedTable(). If an identical table was written before this way,
+  // the new one is removed again, and the old one returned.
+  // Only tables without offset fields (strings, vectors, tables, unions) can
+  // be shared: identical bytes would not mean identical contents for those,
+  // since offsets are relative to where they are stored.
+  void StartSharedTable(size_t alignment) {
+    NotNested();
+    shared_table_start_ = GetSize();
+    // Open the object before the padding, such that a segmented buffer
+    // carries both to a new segment, and a duplicate can be popped.
+    buf_.begin_object();
+    // Start at the same alignment every time, such that identical tables
+    // get identical padding.
+    Align((std::max)(alignment, sizeof(soffset_t)));
+  }
+
+  uoffset_t EndSharedTable(uoffset_t start, voffset_t numfields) {
+    assert(shared_table_start_ <= start);
+    auto table = EndTable(start, numfields);
+    auto hash = HashTable(table);
+    // A table that needed a new vtable has no duplicate, otherwise the
+    // table is the last thing in the buffer.
+    if (GetSize() == table) {
+      auto existing = table_pool_.find(hash, [&](uoffset_t offset) {
+        return TablesEqual(offset, table);
+      });
+      if (existing) {
+        // Also remove the padding added by StartSharedTable().
+        buf_.pop(table - shared_table_start_);
+        // The table is gone, and with it its use of an existing vtable.
+        FLATBUFFERS_BUILDER_STAT(
+          stats_.vtables_reused--;
+          stats_.shared_tables_reused++;
+        )
+        return existing;
+      }
+    }
+    table_pool_.insert(table, hash);
+    return table;
+  }
+
+  // The vtable of a table in the buffer being built.
+  const uint8_t *GetVTable(uoffset_t table) const {
+    // Go through offsets, the vtable may be in another segment.
+    return buf_.data_at(table + ReadScalar<soffset_t>(buf_.data_at(table)));
+  }
+
+  // Hash of the contents of a table, i.e. its vtable and its fields (but not
+  // its vtable offset, which depends on where it is).
+  uint32_t HashTable(uoffset_t table) const {
+    auto vtable = GetVTable(table);
+    auto vt_size = ReadScalar<voffset_t>(vtable);
+    auto size = ReadScalar<voffset_t>(vtable + sizeof(voffset_t));
+    return HashBytes(buf_.data_at(table) + sizeof(soffset_t),
+                     size - sizeof(soffset_t), HashBytes(vtable, vt_size));
+  }
+
+  bool TablesEqual(uoffset_t a, uoffset_t b) const {
+    auto vt_a = GetVTable(a), vt_b = GetVTable(b);
+    auto vt_size = ReadScalar<voffset_t>(vt_a);
+    if (vt_size != ReadScalar<voffset_t>(vt_b) ||
+        memcmp(vt_a, vt_b, vt_size)) return false;
+    auto size = ReadScalar<voffset_t>(vt_a + sizeof(voffset_t));
+    return !memcmp(buf_.data_at(a) + sizeof(soffset_t),
+                   buf_.data_at(b) + sizeof(soffset_t),
+                   size - sizeof(soffset_t));
+  }
+
+  // Writing a table directly, used by the generated Create<Table>Direct()
+  // functions. Their table layout and vtable are computed by flatc, such that
+  // fields can be written straight into place, without tracking them.
+  // Returns the offset of the table, whose "size" bytes are zeroed.
+  uoffset_t StartDirectTable(size_t size, size_t alignment) {
+    NotNested();
+    nested = true;
+    buf_.begin_object();
+    if (alignment > minalign_) minalign_ = alignment;
+    PreAlign(size, alignment);
+    memset(buf_.make_space(size), 0, size);
+    return GetSize();
+  }
+
+  template<typename T> void AddDirectElement(uoffset_t table, voffset_t field,
+                                             T e) {
+    WriteScalar(buf_.data_at(table) + field, e);
+  }
+
+  template<typename T> void AddDirectOffset(uoffset_t table, voffset_t field,
+                                            Offset<T> off) {
+    auto loc = table - field;
+    // If this asserts, a field was left out, or refers to something not
+    // built before this table.
+    assert(off.o && off.o <= loc);
+    WriteScalar(buf_.data_at(table) + field, loc - off.o);
+  }
+
+  template<typename T> void AddDirectStruct(uoffset_t table, voffset_t field,
+                                            const T *structptr) {
+    assert(structptr);  // All fields must be present.
+    memcpy(buf_.data_at(table) + field, structptr, sizeof(T));
+  }
+
+  // "vtable" is the vtable as little endian bytes, "hash" its HashBytes().
+  uoffset_t EndDirectTable(uoffset_t table, const uint8_t *vtable,
+                           uint32_t hash) {
+    assert(nested);
+    auto vt_size = static_cast<voffset_t>(vtable[0] | (vtable[1] << 8));
+    auto vt_use = FindVTable(vtable, vt_size, hash);
+    if (!vt_use) {
+      // No padding needed, the table is aligned to at least soffset_t.
+      PushBytes(vtable, vt_size);
+      vt_use = GetSize();
+      AddVTable(vt_use, hash);
+      FLATBUFFERS_BUILDER_STAT(stats_.vtables_written++;)
+    } else {
+      FLATBUFFERS_BUILDER_STAT(stats_.vtables_reused++;)
+    }
+    WriteScalar(buf_.data_at(table),
+                static_cast<soffset_t>(vt_use) - static_cast<soffset_t>(table));
+    nested = false;
+    buf_.end_object();
+    return table;
+  }
+
   // This checks a required field has been set in a given table that has
   // just been constructed.
   template<typename T> void Required(Offset<T> table, voffset_t field) {
-    auto table_ptr = buf_.data_at(table.o);
-    auto vtable_ptr = table_ptr - ReadScalar<soffset_t>(table_ptr);
-    bool ok = ReadScalar<voffset_t>(vtable_ptr + field) != 0;
+    bool ok = ReadScalar<voffset_t>(GetVTable(table.o) + field) != 0;
     // If this fails, the caller will show what field needs to be set.
     assert(ok);
     (void)ok;
@@ -823,10 +1749,28 @@ FLATBUFFERS_FINAL_CLASS
 
   void ClearOffsets() { offsetbuf_.clear(); }
 
+  // Returns the location of a previously written vtable with the same
+  // contents as "vt" (with the given size and HashBytes() hash), or 0.
+  uoffset_t FindVTable(const uint8_t *vt, voffset_t vt_size,
+                       uint32_t hash) const {
+    return vtables_.find(hash, [&](uoffset_t offset) {
+      auto vt2 = buf_.data_at(offset);
+      return ReadScalar<voffset_t>(vt2) == vt_size &&
+             !memcmp(vt2, vt, vt_size);
+    });
+  }
+
+  // Remember a newly written vtable for use with FindVTable().
+  void AddVTable(uoffset_t offset, uint32_t hash) {
+    vtables_.insert(offset, hash);
+  }
+
   // Aligns such that when "len" bytes are written, an object can be written
   // after it with "alignment" without padding.
   void PreAlign(size_t len, size_t alignment) {
-    buf_.fill(PaddingBytes(GetSize() + len, alignment));
+    auto padding = PaddingBytes(GetSize() + len, alignment);
+    buf_.fill(padding);
+    FLATBUFFERS_BUILDER_STAT(stats_.padding_bytes += padding;)
   }
   template<typename T> void PreAlign(size_t len) {
     AssertScalarT<T>();
@@ -840,10 +1784,12 @@ FLATBUFFERS_FINAL_CLASS
   /// @return Returns the offset in the buffer where the string starts.
   Offset<String> CreateString(const char *str, size_t len) {
     NotNested();
+    buf_.begin_object();
     PreAlign<uoffset_t>(len + 1);  // Always 0-terminated.
     buf_.fill(1);
     PushBytes(reinterpret_cast<const uint8_t *>(str), len);
     PushElement(static_cast<uoffset_t>(len));
+    buf_.end_object();
     return Offset<String>(GetSize());
   }
 
@@ -875,22 +1821,19 @@ FLATBUFFERS_FINAL_CLASS
   /// @param[in] len The number of bytes that should be stored from `str`.
   /// @return Returns the offset in the buffer where the string starts.
   Offset<String> CreateSharedString(const char *str, size_t len) {
-    if (!string_pool)
-      string_pool = new StringOffsetMap(StringOffsetCompare(buf_));
-    auto size_before_string = buf_.size();
-    // Must first serialize the string, since the set is all offsets into
-    // buffer.
-    auto off = CreateString(str, len);
-    auto it = string_pool->find(off);
-    // If it exists we reuse existing serialized data!
-    if (it != string_pool->end()) {
-      // We can remove the string we serialized.
-      buf_.pop(buf_.size() - size_before_string);
-      return *it;
-    }
-    // Record this string for future use.
-    string_pool->insert(off);
-    return off;
+    return CreateSharedString(str, len,
+                              HashBytes(reinterpret_cast<const uint8_t *>(str),
+                                        len));
+  }
+
+  /// @brief Store a string in the buffer, which can contain any binary data.
+  /// If a string with this exact contents has already been serialized before,
+  /// instead simply returns the offset of the existing string.
+  /// @param[in] str A `PrehashedString`, which avoids hashing the same
+  /// string over and over when it is stored in many buffers.
+  /// @return Returns the offset in the buffer where the string starts.
+  Offset<String> CreateSharedString(const PrehashedString &str) {
+    return CreateSharedString(str.str, str.len, str.hash);
   }
 
   /// @brief Store a string in the buffer, which null-terminated.
@@ -920,16 +1863,40 @@ FLATBUFFERS_FINAL_CLASS
     return CreateSharedString(str->c_str(), str->Length());
   }
 
+  /// @cond FLATBUFFERS_INTERNAL
+  // "hash" must be HashBytes() of the string.
+  Offset<String> CreateSharedString(const char *str, size_t len,
+                                    uint32_t hash) {
+    auto off = string_pool_.find(hash, [&](uoffset_t offset) {
+      auto s = reinterpret_cast<const String *>(buf_.data_at(offset));
+      return s->size() == len && !memcmp(s->c_str(), str, len);
+    });
+    // If it exists we reuse existing serialized data!
+    if (off) {
+      FLATBUFFERS_BUILDER_STAT(stats_.shared_strings_reused++;)
+      return Offset<String>(off);
+    }
+    auto new_off = CreateString(str, len);
+    // Record this string for future use.
+    string_pool_.insert(new_off.o, hash);
+    FLATBUFFERS_BUILDER_STAT(stats_.shared_strings_written++;)
+    return new_off;
+  }
+  /// @endcond
+
   /// @cond FLATBUFFERS_INTERNAL
   uoffset_t EndVector(size_t len) {
     assert(nested);  // Hit if no corresponding StartVector.
     nested = false;
-    return PushElement(static_cast<uoffset_t>(len));
+    auto vec = PushElement(static_cast<uoffset_t>(len));
+    buf_.end_object();
+    return vec;
   }
 
   void StartVector(size_t len, size_t elemsize) {
     NotNested();
     nested = true;
+    buf_.begin_object();
     PreAlign<uoffset_t>(len * elemsize);
     PreAlign(len * elemsize, elemsize);  // Just in case elemsize > uoffset_t.
   }
@@ -999,19 +1966,60 @@ FLATBUFFERS_FINAL_CLASS
   }
 
   /// @cond FLATBUFFERS_INTERNAL
-  template<typename T>
-  struct TableKeyComparator {
-  TableKeyComparator(vector_downward& buf) : buf_(buf) {}
-    bool operator()(const Offset<T> &a, const Offset<T> &b) const {
-      auto table_a = reinterpret_cast<T *>(buf_.data_at(a.o));
-      auto table_b = reinterpret_cast<T *>(buf_.data_at(b.o));
-      return table_a->KeyCompareLessThan(table_b);
+  // Sorting tables by key first copies the keys out of the buffer, such that
+  // sorting doesn't dereference tables (and their vtables) over and over.
+  // Scalar keys are radix sorted.
+  // "v" points to either Offset<T>s or plain uoffset_ts.
+  template<typename T, typename O, typename K> void SortTablesByKey(
+                                                    O *v, size_t len, K *) {
+    std::vector<KeyedOffset> entries(len);
+    for (size_t i = 0; i < len; i++) {
+      auto table = reinterpret_cast<const T *>(buf_.data_at(RawOffset(v[i])));
+      entries[i].key = SortableKey(table->GetKeyValue());
+      entries[i].offset = RawOffset(v[i]);
+    }
+    RadixSortByKey(entries);
+    for (size_t i = 0; i < len; i++) RawOffset(v[i]) = entries[i].offset;
+  }
+
+  // String keys are sorted by their first 8 bytes, and only compared in full
+  // when those are equal.
+  template<typename T, typename O> void SortTablesByKey(O *v, size_t len,
+                                                        const String **) {
+    std::vector<StringKeyedOffset> entries(len);
+    for (size_t i = 0; i < len; i++) {
+      auto table = reinterpret_cast<const T *>(buf_.data_at(RawOffset(v[i])));
+      auto key = table->GetKeyValue()->c_str();
+      entries[i].prefix = StringKeyPrefix(key);
+      entries[i].key = key;
+      entries[i].offset = RawOffset(v[i]);
+    }
+    std::sort(entries.begin(), entries.end());
+    for (size_t i = 0; i < len; i++) RawOffset(v[i]) = entries[i].offset;
+  }
+
+  // Place the sorted elements of the subtree rooted at 1-based position "k"
+  // of "out", taking them from sorted[i] onwards. Returns the next "i".
+  template<typename O> static size_t EytzingerOrder(const O *sorted, O *out,
+                                                    size_t len, size_t i,
+                                                    size_t k) {
+    if (k <= len) {
+      i = EytzingerOrder(sorted, out, len, i, 2 * k);
+      out[k - 1] = sorted[i++];
+      i = EytzingerOrder(sorted, out, len, i, 2 * k + 1);
     }
-    vector_downward& buf_;
+    return i;
+  }
 
-  private:
-    TableKeyComparator& operator= (const TableKeyComparator&);
-  };
+  static uoffset_t &RawOffset(uoffset_t &o) { return o; }
+  template<typename T> static uoffset_t &RawOffset(Offset<T> &o) {
+    return o.o;
+  }
+
+  template<typename T> void SortTablesByKey(uoffset_t *v, size_t len) {
+    typedef decltype(std::declval<const T &>().GetKeyValue()) key_type;
+    SortTablesByKey<T>(v, len, static_cast<key_type *>(nullptr));
+  }
   /// @endcond
 
   /// @brief Serialize an array of `table` offsets as a `vector` in the buffer
@@ -1024,7 +2032,11 @@ FLATBUFFERS_FINAL_CLASS
   /// where the vector is stored.
   template<typename T> Offset<Vector<Offset<T>>> CreateVectorOfSortedTables(
                                                      Offset<T> *v, size_t len) {
-    std::sort(v, v + len, TableKeyComparator<T>(buf_));
+    // Reading keys follows offsets within tables, which only works while
+    // the buffer is contiguous.
+    assert(buf_.contiguous());
+    typedef decltype(std::declval<const T &>().GetKeyValue()) key_type;
+    SortTablesByKey<T>(v, len, static_cast<key_type *>(nullptr));
     return CreateVector(v, len);
   }
 
@@ -1040,6 +2052,139 @@ FLATBUFFERS_FINAL_CLASS
     return CreateVectorOfSortedTables(v->data(), v->size());
   }
 
+  /// @brief Serialize an array of `table` offsets as a `vector` in the buffer
+  /// in Eytzinger order: the order of a breadth first walk of a balanced
+  /// binary search tree of the tables, by key. Look up tables in such a
+  /// vector with `Vector::LookupByKeyEytzinger()`, not `LookupByKey()`.
+  /// @tparam T The data type that the offset refers to.
+  /// @param[in] v An array of type `Offset<T>` that contains the `table`
+  /// offsets to store, which is reordered as stored.
+  /// @param[in] len The number of elements to store in the `vector`.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T> Offset<Vector<Offset<T>>> CreateVectorOfEytzingerTables(
+                                                     Offset<T> *v, size_t len) {
+    assert(buf_.contiguous());
+    typedef decltype(std::declval<const T &>().GetKeyValue()) key_type;
+    SortTablesByKey<T>(v, len, static_cast<key_type *>(nullptr));
+    std::vector<Offset<T>> sorted(v, v + len);
+    EytzingerOrder(sorted.data(), v, len, 0, 1);
+    return CreateVector(v, len);
+  }
+
+  /// @brief Serialize a hash index for a vector of tables with a string key,
+  /// for constant time lookups with `Vector::LookupByKeyHashed()`.
+  /// @tparam T The data type that the offset refers to.
+  /// @param[in] v The array of `table` offsets the vector was created from,
+  /// in the order stored (as left by `CreateVectorOfSortedTables()`).
+  /// @param[in] len The number of elements in the vector.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the index is stored.
+  template<typename T> Offset<Vector<uint32_t>> CreateHashIndex(
+                                               const Offset<T> *v, size_t len) {
+    // Reading keys follows offsets within tables, which only works while
+    // the buffer is contiguous.
+    assert(buf_.contiguous());
+    assert(len < 0xFFFFFFFFu);
+    // An open addressing table with a load factor of at most a half, which
+    // keeps probe sequences short.
+    size_t slots = 1;
+    while (slots < len * 2) slots *= 2;
+    std::vector<uint32_t> index(slots, 0);
+    for (size_t i = 0; i < len; i++) {
+      auto table = reinterpret_cast<const T *>(buf_.data_at(v[i].o));
+      auto slot = HashIndexKey(table->GetKeyValue()->c_str()) & (slots - 1);
+      while (index[slot]) slot = (slot + 1) & (slots - 1);
+      index[slot] = static_cast<uint32_t>(i + 1);
+    }
+    return CreateVector(index);
+  }
+
+  /// @brief Serialize a hash index for a vector of tables with a string key,
+  /// see above.
+  template<typename T> Offset<Vector<uint32_t>> CreateHashIndex(
+                                         const std::vector<Offset<T>> &v) {
+    return CreateHashIndex(v.data(), v.size());
+  }
+
+  /// @brief Serialize an array of `table` offsets as a `vector` in the buffer
+  /// in Eytzinger order, see above.
+  template<typename T> Offset<Vector<Offset<T>>> CreateVectorOfEytzingerTables(
+                                                    std::vector<Offset<T>> *v) {
+    return CreateVectorOfEytzingerTables(v->data(), v->size());
+  }
+
+  /// @brief Serialize a `vector` of tables (or strings, or other vectors)
+  /// created one at a time by a function, without having to collect their
+  /// offsets in an array first.
+  /// @param[in] len The number of elements to store in the `vector`.
+  /// @param[in] f A function (object) called as `f(i)` for every `i` in
+  /// `[0, len)`, in order, which creates element `i` with this builder and
+  /// returns its `Offset<T>`. It may create vectors this way itself.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename F> auto CreateVector(size_t len, F f)
+                                       -> Offset<Vector<decltype(f(len))>> {
+    auto start = CollectOffsets(len, f);
+    return Offset<Vector<decltype(f(len))>>(EndOffsetVector(start, len));
+  }
+
+  /// @brief Like `CreateVector(len, f)`, but stores the tables created by `f`
+  /// sorted by key, as `CreateVectorOfSortedTables()` does.
+  template<typename F> auto CreateVectorOfSortedTables(size_t len, F f)
+                                       -> Offset<Vector<decltype(f(len))>> {
+    assert(buf_.contiguous());
+    auto start = CollectOffsets(len, f);
+    SortCollectedTables(start, len, static_cast<decltype(f(len)) *>(nullptr));
+    return Offset<Vector<decltype(f(len))>>(EndOffsetVector(start, len));
+  }
+
+  /// @brief Serialize a `vector` of strings, where `f(i)` returns the
+  /// contents of string `i` as anything `CreateString()` accepts.
+  template<typename F> Offset<Vector<Offset<String>>> CreateVectorOfStrings(
+                                                        size_t len, F f) {
+    return CreateVector(len, [&](size_t i) { return CreateString(f(i)); });
+  }
+
+  /// @brief Like `CreateVectorOfStrings(len, f)`, but stores each distinct
+  /// string only once (see `CreateSharedString()`).
+  template<typename F> Offset<Vector<Offset<String>>>
+                              CreateVectorOfSharedStrings(size_t len, F f) {
+    return CreateVector(len, [&](size_t i) {
+      return CreateSharedString(f(i));
+    });
+  }
+
+  /// @cond FLATBUFFERS_INTERNAL
+  // The offsets returned by the element functions of the above are kept on
+  // a stack owned by the builder, which is reused between (and shared by
+  // nested) calls. Returns where on the stack they start.
+  template<typename F> size_t CollectOffsets(size_t len, F &f) {
+    auto start = offset_stack_.size();
+    for (size_t i = 0; i < len; i++) {
+      auto off = f(i).o;
+      // Any nested use of the stack by f has been undone by now.
+      assert(offset_stack_.size() == start + i);
+      offset_stack_.push_back(off);
+    }
+    return start;
+  }
+
+  template<typename T> void SortCollectedTables(size_t start, size_t len,
+                                                Offset<T> *) {
+    SortTablesByKey<T>(offset_stack_.data() + start, len);
+  }
+
+  uoffset_t EndOffsetVector(size_t start, size_t len) {
+    StartVector(len, sizeof(uoffset_t));
+    for (auto i = len; i > 0; ) {
+      PushElement(Offset<void>(offset_stack_[start + --i]));
+    }
+    offset_stack_.resize(start);
+    return EndVector(len);
+  }
+  /// @endcond
+
   /// @brief Specialized version of `CreateVector` for non-copying use cases.
   /// Write the data any time later to the returned buffer pointer `buf`.
   /// @param[in] len The number of elements to store in the `vector`.
@@ -1072,6 +2217,52 @@ FLATBUFFERS_FINAL_CLASS
                                      reinterpret_cast<uint8_t **>(buf));
   }
 
+  /// @brief Copy everything built so far by another builder into this one,
+  /// such that objects can be built in parallel (e.g. one builder per
+  /// thread) and then combined.
+  /// Since FlatBuffers only use relative offsets within a buffer, the
+  /// objects need no fixing up, only the offsets referring to them from
+  /// outside do: add the returned value to them. The vtables and shared
+  /// strings of `child` are reused by later objects in this builder.
+  /// @param[in] child The builder to copy from, which must not be in the
+  /// middle of building an object. It is not modified, and can be `Clear()`ed
+  /// and reused afterwards.
+  /// @return The amount to add to offsets obtained from `child` to make them
+  /// refer to the copy in this builder.
+  uoffset_t Splice(const FlatBufferBuilder &child) {
+    NotNested();
+    assert(!child.nested && &child != this);
+    // Objects keep their alignment if the copy starts at a multiple of the
+    // largest alignment used in child.
+    Align(child.minalign_);
+    auto base = GetSize();
+    // Segments are in memory order, so push them back to front.
+    auto segs = child.buf_.segments();
+    for (auto it = segs.rbegin(); it != segs.rend(); ++it) {
+      PushBytes(it->data, it->size);
+    }
+    child.vtables_.for_each([&](uoffset_t offset, uint32_t hash) {
+      vtables_.insert(base + offset, hash);
+    });
+    child.string_pool_.for_each([&](uoffset_t offset, uint32_t hash) {
+      string_pool_.insert(base + offset, hash);
+    });
+    child.table_pool_.for_each([&](uoffset_t offset, uint32_t hash) {
+      table_pool_.insert(base + offset, hash);
+    });
+    return base;
+  }
+
+  /// @brief Copy everything built so far by another builder into this one,
+  /// see above.
+  /// @param[in] child The builder to copy from.
+  /// @param[in] root An object in `child`.
+  /// @return The offset of the copy of `root` in this builder.
+  template<typename T> Offset<T> Splice(const FlatBufferBuilder &child,
+                                        Offset<T> root) {
+    return Offset<T>(Splice(child) + root.o);
+  }
+
   /// @brief The length of a FlatBuffer file header.
   static const size_t kFileIdentifierLength = 4;
 
@@ -1080,20 +2271,40 @@ FLATBUFFERS_FINAL_CLASS
   /// will be prefixed with a standard FlatBuffers file header.
   template<typename T> void Finish(Offset<T> root,
                                    const char *file_identifier = nullptr) {
+    Finish(root.o, file_identifier, false);
+  }
+
+  /// @brief Finish a buffer like `Finish()`, but prefix it with its size
+  /// (not counting the prefix itself), such that buffers can be written
+  /// back to back into a stream, and read with `SizePrefixedBufferReader`.
+  /// @param[in] file_identifier An optional file identifier, which follows
+  /// the size prefix.
+  template<typename T> void FinishSizePrefixed(
+                                   Offset<T> root,
+                                   const char *file_identifier = nullptr) {
+    Finish(root.o, file_identifier, true);
+  }
+
+ private:
+  void Finish(uoffset_t root, const char *file_identifier, bool size_prefix) {
     NotNested();
+    // Keep the header in one piece.
+    buf_.begin_object();
     // This will cause the whole buffer to be aligned.
-    PreAlign(sizeof(uoffset_t) + (file_identifier ? kFileIdentifierLength : 0),
+    PreAlign((size_prefix ? sizeof(uoffset_t) : 0) + sizeof(uoffset_t) +
+             (file_identifier ? kFileIdentifierLength : 0),
              minalign_);
     if (file_identifier) {
       assert(strlen(file_identifier) == kFileIdentifierLength);
       buf_.push(reinterpret_cast<const uint8_t *>(file_identifier),
                 kFileIdentifierLength);
     }
-    PushElement(ReferTo(root.o));  // Location of root.
+    PushElement(ReferTo(root));  // Location of root.
+    if (size_prefix) PushElement(GetSize());
+    buf_.end_object();
     finished = true;
   }
 
- private:
   // You shouldn't really be copying instances of this class.
   FlatBufferBuilder(const FlatBufferBuilder &);
   FlatBufferBuilder &operator=(const FlatBufferBuilder &);
@@ -1103,8 +2314,6 @@ FLATBUFFERS_FINAL_CLASS
     voffset_t id;
   };
 
-  simple_allocator default_allocator;
-
   vector_downward buf_;
 
   // Accumulating offsets of table members while it is being built.
@@ -1116,26 +2325,26 @@ FLATBUFFERS_FINAL_CLASS
   // Ensure the buffer is finished before it is being accessed.
   bool finished;
 
-  std::vector<uoffset_t> vtables_;  // todo: Could make this into a map?
+  // All vtables written so far, such that EndTable() can find duplicates
+  // without scanning.
+  offset_hash_set vtables_;
 
   size_t minalign_;
 
   bool force_defaults_;  // Serialize values equal to their defaults anyway.
 
-  struct StringOffsetCompare {
-    StringOffsetCompare(const vector_downward &buf) : buf_(&buf) {}
-    bool operator() (const Offset<String> &a, const Offset<String> &b) const {
-      auto stra = reinterpret_cast<const String *>(buf_->data_at(a.o));
-      auto strb = reinterpret_cast<const String *>(buf_->data_at(b.o));
-      return strncmp(stra->c_str(), strb->c_str(),
-                     std::min(stra->size(), strb->size()) + 1) < 0;
-    }
-    const vector_downward *buf_;
-  };
+  // All strings written with CreateSharedString.
+  offset_hash_set string_pool_;
+
+  // All tables written with EndSharedTable.
+  offset_hash_set table_pool_;
+  uoffset_t shared_table_start_;  // Size before StartSharedTable().
 
-  // For use with CreateSharedString. Instantiated on first use only.
-  typedef std::set<Offset<String>, StringOffsetCompare> StringOffsetMap;
-  StringOffsetMap *string_pool;
+  // Offsets of vector elements being collected, see CollectOffsets().
+  std::vector<uoffset_t> offset_stack_;
+
+  // Counted by the builder itself, see GetStats().
+  BuilderStats stats_;
 };
 /// @}
 
@@ -1151,34 +2360,168 @@ template<typename T> const T *GetRoot(const void *buf) {
   return GetMutableRoot<T>(const_cast<void *>(buf));
 }
 
+// Same as above, for buffers made with FinishSizePrefixed().
+template<typename T> const T *GetSizePrefixedRoot(const void *buf) {
+  return GetRoot<T>(reinterpret_cast<const uint8_t *>(buf) +
+                    sizeof(uoffset_t));
+}
+
+// The size stored in front of a buffer made with FinishSizePrefixed(),
+// which doesn't include the prefix itself.
+inline uoffset_t GetPrefixedSize(const void *buf) {
+  return ReadScalar<uoffset_t>(buf);
+}
+
 // Helper to see if the identifier in a buffer has the expected value.
-inline bool BufferHasIdentifier(const void *buf, const char *identifier) {
-  return strncmp(reinterpret_cast<const char *>(buf) + sizeof(uoffset_t),
+inline bool BufferHasIdentifier(const void *buf, const char *identifier,
+                                bool size_prefixed = false) {
+  return strncmp(reinterpret_cast<const char *>(buf) + sizeof(uoffset_t) +
+                   (size_prefixed ? sizeof(uoffset_t) : 0),
                  identifier, FlatBufferBuilder::kFileIdentifierLength) == 0;
 }
 
+// Walks a sequence of buffers made with FinishSizePrefixed() and stored back
+// to back, e.g. a memory mapped log, or data read from a pipe, without
+// copying them. Buffers are only as aligned as the data passed in is, and as
+// their predecessors in the sequence leave them (each buffer is a multiple of
+// its own alignment in size).
+class SizePrefixedBufferReader FLATBUFFERS_FINAL_CLASS {
+ public:
+  SizePrefixedBufferReader(const void *data, size_t len)
+    : cur_(reinterpret_cast<const uint8_t *>(data)), end_(cur_ + len),
+      begin_(cur_) {}
+
+  // Points "buf" at the next buffer (past its size prefix, so it can be
+  // passed to GetRoot() and the Verifier), and "len" at its size.
+  // Returns false if no complete buffer is left. In that case, position()
+  // tells how much of the data was consumed, such that a reader of a stream
+  // can keep the remainder, append more data to it, and continue from there.
+  bool Next(const uint8_t **buf, size_t *len) {
+    if (static_cast<size_t>(end_ - cur_) < sizeof(uoffset_t)) return false;
+    auto size = GetPrefixedSize(cur_);
+    if (static_cast<size_t>(end_ - cur_) - sizeof(uoffset_t) < size)
+      return false;
+    *buf = cur_ + sizeof(uoffset_t);
+    *len = size;
+    cur_ += sizeof(uoffset_t) + size;
+    return true;
+  }
+
+  // The amount of data consumed so far.
+  size_t position() const { return static_cast<size_t>(cur_ - begin_); }
+
+ private:
+  const uint8_t *cur_;
+  const uint8_t *end_;
+  const uint8_t *begin_;
+};
+
+// Descriptors of how to verify a table type, generated by flatc as
+// T::VerifyDescriptor() for every table T, or built at runtime from a schema
+// (see SchemaVerifier in reflection.h). They drive
+// Verifier::VerifyBufferIteratively(), as an alternative to the recursive
+// T::Verify() methods.
+struct TableVerifyDesc;
+typedef const TableVerifyDesc *(*TableVerifyDescFn)();
+
+struct FieldVerifyDesc {
+  enum Kind {
+    kScalar,           // Inline scalar of "size" bytes.
+    kStruct,           // Inline struct of "size" bytes.
+    kString,
+    kVector,           // Vector of scalars or structs of "size" bytes each.
+    kVectorOfStrings,
+    kVectorOfTables,   // Elements are of type "table".
+    kTable,            // Of type "table".
+    kUnion             // Type in "union_type_field", indexes "union_tables".
+  };
+
+  voffset_t field;
+  const char *name;  // For diagnostics, see Verifier::EnableDiagnostics().
+  uint8_t kind;
+  bool required;
+  size_t size;
+  TableVerifyDescFn table;
+  voffset_t union_type_field;
+  // Entry 0 (NONE) and any gaps between union values are nullptr.
+  const TableVerifyDescFn *union_tables;
+  size_t num_union_tables;
+  // If not nullptr, used instead of "table" (as its only entry) and
+  // "union_tables", by descriptors that aren't generated.
+  const TableVerifyDesc *const *descs;
+};
+
+struct TableVerifyDesc {
+  const FieldVerifyDesc *fields;
+  size_t num_fields;
+};
+
 // Helper class to verify the integrity of a FlatBuffer
 class Verifier FLATBUFFERS_FINAL_CLASS {
  public:
   Verifier(const uint8_t *buf, size_t buf_len, size_t _max_depth = 64,
            size_t _max_tables = 1000000)
     : buf_(buf), end_(buf + buf_len), depth_(0), max_depth_(_max_depth),
-      num_tables_(0), max_tables_(_max_tables)
+      num_tables_(0), max_tables_(_max_tables), visit_once_(false),
+      num_visited_(0), deferred_(nullptr), defer_min_elements_(0),
+      diagnostics_(false), failure_reason_(nullptr), failure_at_(nullptr),
+      bytes_verified_(0), max_depth_reached_(0), cur_field_(nullptr)
     {}
 
+  // Verify objects that are referred to more than once (shared strings and
+  // tables, or any other DAG) only the first time they're reached, such that
+  // verification time is linear in the size of the buffer, and sharing
+  // doesn't count towards max_tables. Objects are remembered along with the
+  // type they were verified as, since a buffer may refer to the same bytes
+  // as different types. Costs some memory per table and vector of tables or
+  // strings.
+  void VerifySharedObjectsOnce(bool enable = true) { visit_once_ = enable; }
+
+  // Have the iterative verifier (VerifyBufferIteratively()) also track the
+  // path of fields leading to each table, such that failure_path() can tell
+  // where a failure happened. This also turns off the assert of
+  // FLATBUFFERS_DEBUG_VERIFICATION_FAILURE, since failures are reported.
+  void EnableDiagnostics(bool enable = true) { diagnostics_ = enable; }
+
   // Central location where any verification failures register.
   bool Check(bool ok) const {
-    #ifdef FLATBUFFERS_DEBUG_VERIFICATION_FAILURE
-      assert(ok);
-    #endif
-    return ok;
+    return ok || Fail("verification failed", nullptr);
+  }
+
+  // The same, recording why a check failed, and where in the buffer.
+  bool Check(bool ok, const char *reason, const void *at) const {
+    return ok || Fail(reason, at);
+  }
+
+  // Why the first failed check failed, nullptr if none did.
+  const char *failure_reason() const { return failure_reason_; }
+
+  // Where the first failed check failed, relative to the start of the buffer
+  // (possibly outside of it, e.g. when an offset points out of the buffer).
+  // 0 if not known.
+  ptrdiff_t failure_offset() const {
+    return failure_at_ ? reinterpret_cast<const uint8_t *>(failure_at_) - buf_
+                       : 0;
   }
 
+  // The fields leading to the first failure, like "enemy.inventory" or
+  // "testarrayoftables[2].name". Only available with EnableDiagnostics(),
+  // when verifying iteratively.
+  const std::string &failure_path() const { return failure_path_; }
+
+  // Total size of all ranges checked so far. Bytes that are checked more than
+  // once (e.g. vtables shared by many tables) count every time.
+  size_t bytes_verified() const { return bytes_verified_; }
+
+  // Deepest nesting of tables seen so far, to compare against max_depth.
+  size_t max_depth_reached() const { return max_depth_reached_; }
+
   // Verify any range within the buffer.
   bool Verify(const void *elem, size_t elem_len) const {
+    bytes_verified_ += elem_len;
     return Check(elem_len <= (size_t) (end_ - buf_) &&
                  elem >= buf_ &&
-                 elem <= end_ - elem_len);
+                 elem <= end_ - elem_len, "out of bounds", elem);
   }
 
   // Verify a range indicated by sizeof(T).
@@ -1188,7 +2531,9 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
 
   // Verify a pointer (may be NULL) of a table type.
   template<typename T> bool VerifyTable(const T *table) {
-    return !table || table->Verify(*this);
+    if (!table || (visit_once_ && Visited(table, TypeKey<T>()))) return true;
+    return table->Verify(*this) &&
+           (!visit_once_ || MarkVisited(table, TypeKey<T>()));
   }
 
   // Verify a pointer (may be NULL) of any vector type.
@@ -1210,7 +2555,8 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
     return !str ||
            (VerifyVector(reinterpret_cast<const uint8_t *>(str), 1, &end) &&
             Verify(end, 1) &&      // Must have terminator
-            Check(*end == '\0'));  // Terminating byte must be 0.
+            // Terminating byte must be 0.
+            Check(*end == '\0', "string not zero terminated", end));
   }
 
   // Common code between vectors and strings.
@@ -1222,7 +2568,7 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
     // must be 0.
     auto size = ReadScalar<uoffset_t>(vec);
     auto max_elems = FLATBUFFERS_MAX_BUFFER_SIZE / elem_size;
-    if (!Check(size < max_elems))
+    if (!Check(size < max_elems, "vector too large", vec))
       return false;  // Protect against byte_size overflowing.
     auto byte_size = sizeof(size) + elem_size * size;
     *end = vec + byte_size;
@@ -1231,22 +2577,24 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
 
   // Special case for string contents, after the above has been called.
   bool VerifyVectorOfStrings(const Vector<Offset<String>> *vec) const {
-      if (vec) {
-        for (uoffset_t i = 0; i < vec->size(); i++) {
-          if (!Verify(vec->Get(i))) return false;
-        }
+      typedef Vector<Offset<String>> vector_type;
+      if (!vec || (visit_once_ && Visited(vec, TypeKey<vector_type>())))
+        return true;
+      for (uoffset_t i = 0; i < vec->size(); i++) {
+        if (!Verify(vec->Get(i))) return false;
       }
-      return true;
+      return !visit_once_ || MarkVisited(vec, TypeKey<vector_type>());
   }
 
   // Special case for table contents, after the above has been called.
   template<typename T> bool VerifyVectorOfTables(const Vector<Offset<T>> *vec) {
-    if (vec) {
-      for (uoffset_t i = 0; i < vec->size(); i++) {
-        if (!vec->Get(i)->Verify(*this)) return false;
-      }
+    typedef Vector<Offset<T>> vector_type;
+    if (!vec || (visit_once_ && Visited(vec, TypeKey<vector_type>())))
+      return true;
+    for (uoffset_t i = 0; i < vec->size(); i++) {
+      if (!VerifyTable(vec->Get(i))) return false;
     }
-    return true;
+    return !visit_once_ || MarkVisited(vec, TypeKey<vector_type>());
   }
 
   // Verify this whole buffer, starting with root type T.
@@ -1257,14 +2605,88 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
         Verify(*this);
   }
 
+  // Verify a whole buffer made with FinishSizePrefixed(), including that the
+  // prefix matches the size of the buffer being verified.
+  template<typename T> bool VerifySizePrefixedBuffer() {
+    if (!Verify<uoffset_t>(buf_) ||
+        !Check(ReadScalar<uoffset_t>(buf_) ==
+               static_cast<size_t>(end_ - buf_) - sizeof(uoffset_t),
+               "size prefix doesn't match buffer size", buf_))
+      return false;
+    auto buf = buf_ + sizeof(uoffset_t);
+    return Verify<uoffset_t>(buf) &&
+      reinterpret_cast<const T *>(buf + ReadScalar<uoffset_t>(buf))->
+        Verify(*this);
+  }
+
+  // Verify this whole buffer, starting with root type T, without recursing:
+  // walks the buffer with an explicit work stack over the descriptors from
+  // T::VerifyDescriptor(), so the amount of (native) stack used is constant
+  // no matter how deeply the buffer nests, e.g. for use on small coroutine
+  // stacks. Accepts exactly the same buffers as VerifyBuffer().
+  template<typename T> bool VerifyBufferIteratively() {
+    return VerifyBufferIteratively(T::VerifyDescriptor());
+  }
+
+  // The same, with the root table type described by "desc".
+  bool VerifyBufferIteratively(const TableVerifyDesc *desc) {
+    return Verify<uoffset_t>(buf_) &&
+           VerifyTableIteratively(buf_ + ReadScalar<uoffset_t>(buf_), desc);
+  }
+
+  // Verify a table, and everything it refers to, as described by "desc".
+  bool VerifyTableIteratively(const uint8_t *table,
+                              const TableVerifyDesc *desc) {
+    work_.clear();
+    path_.clear();
+    PushTable(table, desc, depth_ + 1, 0);
+    return VerifyWork();
+  }
+
+  // Verify elements [begin, end) of a vector of tables (already checked with
+  // VerifyVector()) described by "desc", those elements being at "depth".
+  bool VerifyVectorOfTablesIteratively(const uint8_t *vec, uoffset_t begin,
+                                       uoffset_t end,
+                                       const TableVerifyDesc *desc,
+                                       size_t depth) {
+    work_.clear();
+    path_.clear();
+    verify_work_item item = { nullptr, vec, desc, begin, end, depth, 0 };
+    work_.push_back(item);
+    return VerifyWork();
+  }
+
+  // A vector of tables whose elements still need verification, see
+  // DeferVectorsOfTables().
+  struct DeferredVector {
+    const uint8_t *vec;
+    const TableVerifyDesc *desc;
+    size_t depth;
+  };
+
+  // Have the iterative verifier append vectors of at least "min_elements"
+  // tables to "deferred" instead of verifying their elements, such that the
+  // caller may verify them with VerifyVectorOfTablesIteratively() later, e.g.
+  // on other threads (see ParallelVerifier). Pass nullptr to stop deferring.
+  void DeferVectorsOfTables(std::vector<DeferredVector> *deferred,
+                            size_t min_elements) {
+    deferred_ = deferred;
+    defer_min_elements_ = min_elements;
+  }
+
+  // The number of tables verified so far, counted against max_tables.
+  size_t num_tables() const { return num_tables_; }
+
   // Called at the start of a table to increase counters measuring data
   // structure depth and amount, and possibly bails out with false if
   // limits set by the constructor have been hit. Needs to be balanced
   // with EndTable().
-  bool VerifyComplexity() {
+  bool VerifyComplexity(const void *table = nullptr) {
     depth_++;
     num_tables_++;
-    return Check(depth_ <= max_depth_ && num_tables_ <= max_tables_);
+    max_depth_reached_ = (std::max)(max_depth_reached_, depth_);
+    return Check(depth_ <= max_depth_, "too deep", table) &&
+           Check(num_tables_ <= max_tables_, "too many tables", table);
   }
 
   // Called at the end of a table to pop the depth count.
@@ -1274,12 +2696,295 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
   }
 
  private:
+  bool Fail(const char *reason, const void *at) const {
+    #ifdef FLATBUFFERS_DEBUG_VERIFICATION_FAILURE
+      assert(diagnostics_);
+    #endif
+    if (!failure_reason_) {
+      failure_reason_ = reason;
+      failure_at_ = at;
+    }
+    return false;
+  }
+
+  // A unique address per type T.
+  template<typename T> static const void *TypeKey() {
+    static const char key = 0;
+    return &key;
+  }
+
+  // Set of objects verified so far in VerifySharedObjectsOnce() mode:
+  // open addressing with linear probing, never more than half full.
+  struct visited_entry {
+    const void *obj;
+    const void *type;
+  };
+
+  static size_t VisitedHash(const void *obj, const void *type) {
+    auto h = reinterpret_cast<size_t>(obj) ^
+             (reinterpret_cast<size_t>(type) * 31);
+    return h ^ (h >> 7) ^ (h >> 17);
+  }
+
+  bool Visited(const void *obj, const void *type) const {
+    if (visited_.empty()) return false;
+    auto mask = visited_.size() - 1;
+    for (auto i = VisitedHash(obj, type) & mask; visited_[i].obj;
+         i = (i + 1) & mask) {
+      if (visited_[i].obj == obj && visited_[i].type == type) return true;
+    }
+    return false;
+  }
+
+  // Always returns true, for use in the expressions above.
+  bool MarkVisited(const void *obj, const void *type) const {
+    if ((num_visited_ + 1) * 2 > visited_.size()) {
+      std::vector<visited_entry> old_entries(
+        (std::max)(visited_.size() * 2, static_cast<size_t>(64)));
+      old_entries.swap(visited_);
+      num_visited_ = 0;
+      for (auto it = old_entries.begin(); it != old_entries.end(); ++it) {
+        if (it->obj) MarkVisited(it->obj, it->type);
+      }
+    }
+    auto mask = visited_.size() - 1;
+    auto i = VisitedHash(obj, type) & mask;
+    while (visited_[i].obj) i = (i + 1) & mask;
+    visited_[i].obj = obj;
+    visited_[i].type = type;
+    num_visited_++;
+    return true;
+  }
+
+  // Pending work of VerifyTableIteratively(): either a table, or a vector of
+  // tables of which the elements [next, end) are still to be pushed.
+  // "depth" is that of the table (or vector elements), "path" how it was
+  // reached (see path_).
+  struct verify_work_item {
+    const uint8_t *table;
+    const uint8_t *vec;
+    const TableVerifyDesc *desc;
+    uoffset_t next;
+    uoffset_t end;
+    size_t depth;
+    size_t path;
+  };
+
+  // With EnableDiagnostics(), a node per field (or vector element, when
+  // "field" is nullptr) followed to reach a table. "parent" is the index of
+  // the previous node plus one, 0 being the root.
+  struct verify_path_node {
+    size_t parent;
+    const FieldVerifyDesc *field;
+    uoffset_t index;
+  };
+
+  size_t AddPath(size_t parent, const FieldVerifyDesc *field,
+                 uoffset_t index) {
+    if (!diagnostics_) return 0;
+    verify_path_node node = { parent, field, index };
+    path_.push_back(node);
+    return path_.size();
+  }
+
+  static std::string IndexString(uoffset_t index) {
+    std::string s = "]";
+    do {
+      s.insert(s.begin(), static_cast<char>('0' + index % 10));
+      index /= 10;
+    } while (index);
+    return "[" + s;
+  }
+
+  std::string PathString(size_t path, const FieldVerifyDesc *field) const {
+    std::vector<std::string> parts;
+    if (field) parts.push_back(field->name ? field->name : "?");
+    for (; path; path = path_[path - 1].parent) {
+      auto &node = path_[path - 1];
+      parts.push_back(node.field
+                        ? (node.field->name ? node.field->name : "?")
+                        : IndexString(node.index));
+    }
+    std::string s;
+    for (auto it = parts.rbegin(); it != parts.rend(); ++it) {
+      if (!s.empty() && (*it)[0] != '[') s += ".";
+      s += *it;
+    }
+    return s;
+  }
+
+  bool VerifyWork() {
+    while (!work_.empty()) {
+      auto item = work_.back();
+      if (item.vec) {
+        // Vectors of tables stay on the stack until all elements are pushed,
+        // so the stack holds at most one entry per field per level.
+        if (item.next == item.end) {
+          work_.pop_back();
+          continue;
+        }
+        work_.back().next++;
+        auto p = item.vec + sizeof(uoffset_t) + item.next * sizeof(uoffset_t);
+        PushTable(p + ReadScalar<uoffset_t>(p), item.desc, item.depth,
+                  AddPath(item.path, nullptr, item.next));
+      } else {
+        work_.pop_back();
+        if (!VerifyTableFields(item.table, item.desc, item.depth, item.path)) {
+          if (diagnostics_ && failure_path_.empty())
+            failure_path_ = PathString(item.path, cur_field_);
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  void PushTable(const uint8_t *table, const TableVerifyDesc *desc,
+                 size_t depth, size_t path) {
+    if (visit_once_) {
+      // Marking before the table is verified is fine, since any failure
+      // ends verification altogether.
+      if (Visited(table, desc)) return;
+      MarkVisited(table, desc);
+    }
+    verify_work_item item = { table, nullptr, desc, 0, 0, depth, path };
+    work_.push_back(item);
+  }
+
+  // Call after VerifyVector().
+  void PushVectorOfTables(const uint8_t *vec, const TableVerifyDesc *desc,
+                          size_t depth, size_t path) {
+    auto size = ReadScalar<uoffset_t>(vec);
+    if (!size) return;
+    if (deferred_ && size >= defer_min_elements_) {
+      DeferredVector deferred = { vec, desc, depth };
+      deferred_->push_back(deferred);
+      return;
+    }
+    if (visit_once_) {
+      // Any address unique to the element type will do as key.
+      if (Visited(vec, &desc->num_fields)) return;
+      MarkVisited(vec, &desc->num_fields);
+    }
+    verify_work_item item = { nullptr, vec, desc, 0, size, depth, path };
+    work_.push_back(item);
+  }
+
+  static const TableVerifyDesc *GetTableDesc(const FieldVerifyDesc &f,
+                                             size_t i) {
+    if (f.descs) return f.descs[i];
+    auto fn = f.kind == FieldVerifyDesc::kUnion ? f.union_tables[i] : f.table;
+    return fn ? fn() : nullptr;
+  }
+
+  // Checks the type field of union "f", and sets "desc" to the table type it
+  // selects, nullptr for NONE.
+  bool VerifyUnionType(const uint8_t *table, const uint8_t *vtable,
+                       voffset_t vtsize, const FieldVerifyDesc &f,
+                       const TableVerifyDesc **desc) {
+    auto type_offset = f.union_type_field < vtsize
+                         ? ReadScalar<voffset_t>(vtable + f.union_type_field)
+                         : 0;
+    if (!type_offset) return true;  // NONE.
+    if (!Verify<uint8_t>(table + type_offset)) return false;
+    auto type = ReadScalar<uint8_t>(table + type_offset);
+    if (!type) return true;
+    *desc = type < f.num_union_tables ? GetTableDesc(f, type) : nullptr;
+    return Check(*desc != nullptr, "unknown union type", table + type_offset);
+  }
+
+  // The iterative equivalent of a generated Verify() method: checks the table
+  // itself and its inline fields, and pushes any tables it refers to.
+  bool VerifyTableFields(const uint8_t *table, const TableVerifyDesc *desc,
+                         size_t depth, size_t path) {
+    cur_field_ = nullptr;
+    if (!Verify<soffset_t>(table)) return false;
+    auto vtable = table - ReadScalar<soffset_t>(table);
+    num_tables_++;
+    max_depth_reached_ = (std::max)(max_depth_reached_, depth);
+    if (!Check(depth <= max_depth_, "too deep", table) ||
+        !Check(num_tables_ <= max_tables_, "too many tables", table) ||
+        !Verify<voffset_t>(vtable))
+      return false;
+    auto vtsize = ReadScalar<voffset_t>(vtable);
+    if (!Verify(vtable, vtsize)) return false;
+    auto end_fields = desc->fields + desc->num_fields;
+    for (auto f = desc->fields; f != end_fields; ++f) {
+      cur_field_ = f;
+      auto field_offset = f->field < vtsize
+                            ? ReadScalar<voffset_t>(vtable + f->field)
+                            : 0;
+      // Like the generated code, check the union type even without a value.
+      const TableVerifyDesc *union_desc = nullptr;
+      if (f->kind == FieldVerifyDesc::kUnion &&
+          !VerifyUnionType(table, vtable, vtsize, *f, &union_desc))
+        return false;
+      if (!field_offset) {
+        if (!Check(!f->required, "required field missing", table))
+          return false;
+        continue;
+      }
+      auto p = table + field_offset;
+      if (f->kind == FieldVerifyDesc::kScalar ||
+          f->kind == FieldVerifyDesc::kStruct) {
+        if (!Verify(p, f->size)) return false;
+        continue;
+      }
+      if (!Verify<uoffset_t>(p)) return false;
+      auto obj = p + ReadScalar<uoffset_t>(p);
+      const uint8_t *end;
+      switch (f->kind) {
+        case FieldVerifyDesc::kString:
+          if (!Verify(reinterpret_cast<const String *>(obj))) return false;
+          break;
+        case FieldVerifyDesc::kVector:
+          if (!VerifyVector(obj, f->size, &end)) return false;
+          break;
+        case FieldVerifyDesc::kVectorOfStrings:
+          if (!VerifyVector(obj, sizeof(uoffset_t), &end) ||
+              !VerifyVectorOfStrings(
+                 reinterpret_cast<const Vector<Offset<String>> *>(obj)))
+            return false;
+          break;
+        case FieldVerifyDesc::kVectorOfTables:
+          if (!VerifyVector(obj, sizeof(uoffset_t), &end)) return false;
+          PushVectorOfTables(obj, GetTableDesc(*f, 0), depth + 1,
+                             AddPath(path, f, 0));
+          break;
+        case FieldVerifyDesc::kTable:
+          PushTable(obj, GetTableDesc(*f, 0), depth + 1, AddPath(path, f, 0));
+          break;
+        case FieldVerifyDesc::kUnion:
+          if (union_desc)  // Not NONE.
+            PushTable(obj, union_desc, depth + 1, AddPath(path, f, 0));
+          break;
+        default:
+          return Check(false, "unknown field kind", table);
+      }
+    }
+    return true;
+  }
+
   const uint8_t *buf_;
   const uint8_t *end_;
   size_t depth_;
   size_t max_depth_;
   size_t num_tables_;
   size_t max_tables_;
+  bool visit_once_;
+  mutable std::vector<visited_entry> visited_;
+  mutable size_t num_visited_;
+  std::vector<verify_work_item> work_;
+  std::vector<DeferredVector> *deferred_;
+  size_t defer_min_elements_;
+  bool diagnostics_;
+  mutable const char *failure_reason_;
+  mutable const void *failure_at_;
+  std::string failure_path_;
+  mutable size_t bytes_verified_;
+  size_t max_depth_reached_;
+  std::vector<verify_path_node> path_;
+  const FieldVerifyDesc *cur_field_;
 };
 
 // "structs" are flat structures that do not have an offset table, thus
@@ -1308,6 +3013,84 @@ class Struct FLATBUFFERS_FINAL_CLASS {
   uint8_t data_[1];
 };
 
+// Decoded vtables, for reading fields of many tables that share a few
+// vtables, e.g. in a loop over a large vector of tables. The field offsets of
+// a vtable are decoded once, after which finding a field in any table with
+// that vtable takes a comparison and a single load, instead of reading the
+// vtable size and field slot from the vtable again for every field read.
+// Pass it to the accessors flatc --gen-vtable-cache generates, e.g.
+// monster->hp(cache). The most recently used few vtables are kept.
+// A cache is meant to be used by one thread, for one buffer at a time, see
+// Clear().
+// Whether this beats the plain accessors depends on the code around it: when
+// those are inlined into a loop, compilers often share the vtable reads
+// between the fields of a table already, so measure.
+class VTableCache {
+ public:
+  VTableCache() { Clear(); }
+
+  // Forget all decoded vtables. Vtables are recognized by their address, so
+  // call this before reading a buffer that reuses the memory of an earlier
+  // one, otherwise fields may be read through a stale vtable.
+  void Clear() {
+    for (size_t i = 0; i < kNumEntries; i++) entries_[i].vtable = nullptr;
+    last_vtable_ = nullptr;
+    last_ = entries_;
+    next_ = 0;
+  }
+
+  // As Table::GetOptionalFieldOffset(): the offset of "field" in "table", or
+  // 0 if not present.
+  voffset_t GetOptionalFieldOffset(const uint8_t *table, voffset_t field) {
+    auto vtable = table - ReadScalar<soffset_t>(table);
+    if (vtable != last_vtable_) {
+      last_ = Lookup(vtable);
+      last_vtable_ = vtable;
+    }
+    auto i = field / sizeof(voffset_t) - 2;
+    if (i < kMaxFields) return last_->offsets[i];
+    // Past what is decoded, read the vtable after all.
+    return field < last_->vtsize ? ReadScalar<voffset_t>(vtable + field) : 0;
+  }
+
+ private:
+  static const size_t kNumEntries = 4;
+  static const size_t kMaxFields = 32;
+
+  struct Entry {
+    const uint8_t *vtable;
+    voffset_t vtsize;
+    // The offset of each field, 0 for fields outside of the vtable.
+    voffset_t offsets[kMaxFields];
+  };
+
+  Entry *Lookup(const uint8_t *vtable) {
+    for (size_t i = 0; i < kNumEntries; i++) {
+      if (entries_[i].vtable == vtable) return &entries_[i];
+    }
+    // Replace entries in turn.
+    auto &entry = entries_[next_];
+    next_ = (next_ + 1) % kNumEntries;
+    entry.vtable = vtable;
+    entry.vtsize = ReadScalar<voffset_t>(vtable);
+    for (size_t i = 0; i < kMaxFields; i++) {
+      auto field = (i + 2) * sizeof(voffset_t);
+      entry.offsets[i] = field < entry.vtsize
+                           ? ReadScalar<voffset_t>(vtable + field)
+                           : 0;
+    }
+    return &entry;
+  }
+
+  VTableCache(const VTableCache &);
+  VTableCache &operator=(const VTableCache &);
+
+  const uint8_t *last_vtable_;
+  Entry entries_[kNumEntries];
+  Entry *last_;
+  size_t next_;
+};
+
 // "tables" use an offset table (possibly shared) that allows fields to be
 // omitted and added at will, but uses an extra indirection to read.
 class Table {
@@ -1329,6 +3112,28 @@ class Table {
     return field_offset ? ReadScalar<T>(data_ + field_offset) : defaultval;
   }
 
+  // The same as the above, with the vtable decoded through "cache".
+  template<typename T> T GetField(VTableCache &cache, voffset_t field,
+                                  T defaultval) const {
+    auto field_offset = cache.GetOptionalFieldOffset(data_, field);
+    return field_offset ? ReadScalar<T>(data_ + field_offset) : defaultval;
+  }
+
+  template<typename P> P GetPointer(VTableCache &cache,
+                                    voffset_t field) const {
+    auto field_offset = cache.GetOptionalFieldOffset(data_, field);
+    auto p = data_ + field_offset;
+    return field_offset
+      ? reinterpret_cast<P>(p + ReadScalar<uoffset_t>(p))
+      : nullptr;
+  }
+
+  template<typename P> P GetStruct(VTableCache &cache,
+                                   voffset_t field) const {
+    auto field_offset = cache.GetOptionalFieldOffset(data_, field);
+    return field_offset ? reinterpret_cast<P>(data_ + field_offset) : nullptr;
+  }
+
   template<typename P> P GetPointer(voffset_t field) {
     auto field_offset = GetOptionalFieldOffset(field);
     auto p = data_ + field_offset;
@@ -1381,7 +3186,7 @@ class Table {
     if (!verifier.Verify<soffset_t>(data_)) return false;
     auto vtable = data_ - ReadScalar<soffset_t>(data_);
     // Check the vtable size field, then check vtable fits in its entirety.
-    return verifier.VerifyComplexity() &&
+    return verifier.VerifyComplexity(data_) &&
            verifier.Verify<voffset_t>(vtable) &&
            verifier.Verify(vtable, ReadScalar<voffset_t>(vtable));
   }
@@ -1400,7 +3205,7 @@ class Table {
   template<typename T> bool VerifyFieldRequired(const Verifier &verifier,
                                         voffset_t field) const {
     auto field_offset = GetOptionalFieldOffset(field);
-    return verifier.Check(field_offset != 0) &&
+    return verifier.Check(field_offset != 0, "required field missing", data_) &&
            verifier.Verify<T>(data_ + field_offset);
   }
 
@@ -1425,6 +3230,237 @@ template<typename T> bool IsFieldPresent(const T *table, voffset_t field) {
   return reinterpret_cast<const Table *>(table)->CheckField(field);
 }
 
+// Read scalar field "field" (a VT_ constant of table type U) of every table
+// in "tables" into out[0 .. tables.size()), using "defaultval" where it is
+// absent, like GetField() would. Tables usually share vtables with their
+// neighbours, so a vtable is only decoded when it differs from that of the
+// previous table. Generated code wraps this per scalar field as e.g.
+// Monster::gather_hp(), reflection users can pass reflection::Field::offset().
+template<typename T, typename U>
+void GatherField(const Vector<Offset<U>> &tables, voffset_t field,
+                 T defaultval, T *out) {
+  auto data = tables.Data();
+  auto size = tables.size();
+  const uint8_t *last_vtable = nullptr;
+  voffset_t field_offset = 0;
+  for (uoffset_t i = 0; i < size; i++) {
+    auto p = data + i * sizeof(uoffset_t);
+    auto table = p + ReadScalar<uoffset_t>(p);
+    auto vtable = table - ReadScalar<soffset_t>(table);
+    if (vtable != last_vtable) {
+      last_vtable = vtable;
+      field_offset = field < ReadScalar<voffset_t>(vtable)
+                       ? ReadScalar<voffset_t>(vtable + field)
+                       : 0;
+    }
+    out[i] = field_offset ? ReadScalar<T>(table + field_offset) : defaultval;
+  }
+}
+
+// Lazily checked access to untrusted buffers, as an alternative to verifying
+// a buffer entirely before reading it: every offset is checked against the
+// bounds of the buffer when it is followed, so the cost is proportional to
+// what is actually read. flatc --gen-checked generates a Checked<Table> view
+// per table on top of CheckedTable, and a GetChecked<Root>() function.
+// Anything that fails a check reads as absent (nullptr, a null view or the
+// default value) and marks the CheckedBuffer as not ok(), such that callers
+// can tell corrupt data from absent data. Nothing asserts.
+// Unlike a Verifier, nothing bounds the total amount of work (e.g. when
+// walking a buffer with shared subobjects), only the work per access.
+// A CheckedBuffer and its views are meant to be used by one thread.
+class CheckedTable;
+
+class CheckedBuffer {
+ public:
+  CheckedBuffer(const uint8_t *buf, size_t buf_len)
+    : buf_(buf), end_(buf + buf_len), failed_(false) {}
+
+  // False once any access has found the buffer to be corrupt.
+  bool ok() const { return !failed_; }
+
+  CheckedTable GetRootTable() const;
+
+  // Check a range lies within the buffer.
+  bool Check(const void *elem, size_t elem_len) const {
+    if (elem_len <= static_cast<size_t>(end_ - buf_) &&
+        elem >= buf_ && elem <= end_ - elem_len)
+      return true;
+    failed_ = true;
+    return false;
+  }
+
+  // Check a vector with elements of "elem_size" bytes, returns it or nullptr.
+  const uint8_t *CheckVector(const uint8_t *vec, size_t elem_size) const {
+    if (!Check(vec, sizeof(uoffset_t))) return nullptr;
+    auto size = ReadScalar<uoffset_t>(vec);
+    if (size >= FLATBUFFERS_MAX_BUFFER_SIZE / elem_size) {
+      failed_ = true;
+      return nullptr;
+    }
+    return Check(vec, sizeof(uoffset_t) + elem_size * size) ? vec : nullptr;
+  }
+
+  // Check a string including its terminator, returns it or nullptr.
+  const String *CheckString(const uint8_t *str) const {
+    if (!CheckVector(str, 1)) return nullptr;
+    auto end = str + sizeof(uoffset_t) + ReadScalar<uoffset_t>(str);
+    if (!Check(end, 1)) return nullptr;
+    if (*end) {
+      failed_ = true;
+      return nullptr;
+    }
+    return reinterpret_cast<const String *>(str);
+  }
+
+ private:
+  const uint8_t *buf_;
+  const uint8_t *end_;
+  mutable bool failed_;
+};
+
+template<typename T> class CheckedVectorOfTables;
+class CheckedVectorOfStrings;
+
+// A table inside a CheckedBuffer, with accessors like those of Table that
+// check everything they read. Its vtable is checked once, on construction.
+class CheckedTable {
+ public:
+  CheckedTable()
+    : buffer_(nullptr), data_(nullptr), vtable_(nullptr), vtsize_(0) {}
+
+  // Yields a null table if "data" or its vtable don't fit in the buffer.
+  CheckedTable(const CheckedBuffer *buffer, const uint8_t *data)
+    : buffer_(buffer), data_(nullptr), vtable_(nullptr), vtsize_(0) {
+    if (!buffer->Check(data, sizeof(soffset_t))) return;
+    auto vtable = data - ReadScalar<soffset_t>(data);
+    if (!buffer->Check(vtable, sizeof(voffset_t))) return;
+    auto vtsize = ReadScalar<voffset_t>(vtable);
+    if (!buffer->Check(vtable, vtsize)) return;
+    data_ = data;
+    vtable_ = vtable;
+    vtsize_ = vtsize;
+  }
+
+  // True if the table is absent, or was found to be corrupt.
+  bool IsNull() const { return !data_; }
+
+  template<typename T> T GetField(voffset_t field, T defaultval) const {
+    auto p = GetAddressOf(field, sizeof(T));
+    return p ? ReadScalar<T>(p) : defaultval;
+  }
+
+  template<typename S> const S *GetStruct(voffset_t field) const {
+    return reinterpret_cast<const S *>(GetAddressOf(field, sizeof(S)));
+  }
+
+  const String *GetString(voffset_t field) const {
+    auto p = GetPointer(field);
+    return p ? buffer_->CheckString(p) : nullptr;
+  }
+
+  // "V" is the Vector type, "elem_size" the size of its elements in the
+  // buffer (which for structs is not sizeof(V::return_type)).
+  template<typename V> const V *GetVector(voffset_t field,
+                                          size_t elem_size) const {
+    auto p = GetPointer(field);
+    return reinterpret_cast<const V *>(
+      p ? buffer_->CheckVector(p, elem_size) : nullptr);
+  }
+
+  CheckedTable GetTable(voffset_t field) const {
+    auto p = GetPointer(field);
+    return p ? CheckedTable(buffer_, p) : CheckedTable();
+  }
+
+  template<typename T> CheckedVectorOfTables<T> GetVectorOfTables(
+                                                   voffset_t field) const;
+  CheckedVectorOfStrings GetVectorOfStrings(voffset_t field) const;
+
+ private:
+  const uint8_t *GetAddressOf(voffset_t field, size_t size) const {
+    if (!data_ || field + sizeof(voffset_t) > vtsize_) return nullptr;
+    auto field_offset = ReadScalar<voffset_t>(vtable_ + field);
+    if (!field_offset) return nullptr;
+    auto p = data_ + field_offset;
+    return buffer_->Check(p, size) ? p : nullptr;
+  }
+
+  const uint8_t *GetPointer(voffset_t field) const {
+    auto p = GetAddressOf(field, sizeof(uoffset_t));
+    return p ? p + ReadScalar<uoffset_t>(p) : nullptr;
+  }
+
+  const CheckedBuffer *buffer_;
+  const uint8_t *data_;
+  const uint8_t *vtable_;
+  voffset_t vtsize_;
+};
+
+inline CheckedTable CheckedBuffer::GetRootTable() const {
+  return Check(buf_, sizeof(uoffset_t))
+    ? CheckedTable(this, buf_ + ReadScalar<uoffset_t>(buf_))
+    : CheckedTable();
+}
+
+// A vector of tables inside a CheckedBuffer, "T" being CheckedTable or a
+// generated Checked<Table> type. Elements are checked when accessed.
+template<typename T> class CheckedVectorOfTables {
+ public:
+  CheckedVectorOfTables() : buffer_(nullptr), vec_(nullptr) {}
+  CheckedVectorOfTables(const CheckedBuffer *buffer, const uint8_t *vec)
+    : buffer_(buffer), vec_(vec) {}
+
+  bool IsNull() const { return !vec_; }
+  uoffset_t size() const { return vec_ ? ReadScalar<uoffset_t>(vec_) : 0; }
+
+  // Yields a null table if "i" is out of range.
+  T Get(uoffset_t i) const {
+    if (i >= size()) return T();
+    auto p = vec_ + sizeof(uoffset_t) + i * sizeof(uoffset_t);
+    return T(CheckedTable(buffer_, p + ReadScalar<uoffset_t>(p)));
+  }
+
+ private:
+  const CheckedBuffer *buffer_;
+  const uint8_t *vec_;
+};
+
+// A vector of strings inside a CheckedBuffer.
+class CheckedVectorOfStrings {
+ public:
+  CheckedVectorOfStrings() : buffer_(nullptr), vec_(nullptr) {}
+  CheckedVectorOfStrings(const CheckedBuffer *buffer, const uint8_t *vec)
+    : buffer_(buffer), vec_(vec) {}
+
+  bool IsNull() const { return !vec_; }
+  uoffset_t size() const { return vec_ ? ReadScalar<uoffset_t>(vec_) : 0; }
+
+  // Yields nullptr if "i" is out of range.
+  const String *Get(uoffset_t i) const {
+    if (i >= size()) return nullptr;
+    auto p = vec_ + sizeof(uoffset_t) + i * sizeof(uoffset_t);
+    return buffer_->CheckString(p + ReadScalar<uoffset_t>(p));
+  }
+
+ private:
+  const CheckedBuffer *buffer_;
+  const uint8_t *vec_;
+};
+
+template<typename T> CheckedVectorOfTables<T> CheckedTable::GetVectorOfTables(
+                                                voffset_t field) const {
+  auto p = GetPointer(field);
+  return CheckedVectorOfTables<T>(
+    buffer_, p ? buffer_->CheckVector(p, sizeof(uoffset_t)) : nullptr);
+}
+
+inline CheckedVectorOfStrings CheckedTable::GetVectorOfStrings(
+                                              voffset_t field) const {
+  auto p = GetPointer(field);
+  return CheckedVectorOfStrings(
+    buffer_, p ? buffer_->CheckVector(p, sizeof(uoffset_t)) : nullptr);
+}
+
 // Utility function for reverse lookups on the EnumNames*() functions
 // (in the generated C++ code)
 // names must be NULL terminated.
@@ -332,6 +332,8 @@ struct IDLOptions {
   bool scoped_enums;
   bool include_dependence_headers;
   bool mutable_buffer;
+  bool checked_accessors;
+  bool vtable_cache_accessors;
   bool one_file;
   bool proto_mode;
   bool generate_all;
@@ -352,6 +354,8 @@ struct IDLOptions {
       output_enum_identifiers(true), prefixed_enums(true), scoped_enums(false),
       include_dependence_headers(true),
       mutable_buffer(false),
+      checked_accessors(false),
+      vtable_cache_accessors(false),
       one_file(false),
       proto_mode(false),
       generate_all(false),
@@ -422,9 +426,12 @@ class Parser {
     known_attributes_["bit_flags"] = true;
     known_attributes_["original_order"] = true;
     known_attributes_["nested_flatbuffer"] = true;
+    known_attributes_["key_layout"] = true;
+    known_attributes_["hash_index"] = true;
     known_attributes_["csharp_partial"] = true;
     known_attributes_["stream"] = true;
     known_attributes_["idempotent"] = true;
+    known_attributes_["offset64"] = true;
   }
 
   ~Parser() {
@@ -448,6 +455,13 @@ class Parser {
   // Set the root type. May override the one set in the schema.
   bool SetRootType(const char *name);
 
+  // Whether buffers of this schema use 64bit offsets, which is the case if
+  // its root table is marked (offset64).
+  bool UsesOffset64() const {
+    return root_struct_def_ &&
+           root_struct_def_->attributes.Lookup("offset64") != nullptr;
+  }
+
   // Mark all definitions as already having code generated.
   void MarkGenerated();
 
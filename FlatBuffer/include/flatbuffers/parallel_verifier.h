@@ -0,0 +1,127 @@
+/*
+ * Copyright 2015 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_PARALLEL_VERIFIER_H_
+#define FLATBUFFERS_PARALLEL_VERIFIER_H_
+
+#include <atomic>
+#include <thread>
+
+#include "flatbuffers/flatbuffers.h"
+
+// Verification of large buffers on multiple threads, for buffers that are
+// dominated by big vectors of tables (e.g. snapshots of many records).
+
+namespace flatbuffers {
+
+// Verifies a buffer like Verifier::VerifyBuffer(), with the same limits and
+// the same verdict, but verifies the elements of large vectors of tables on
+// several threads. The tree is first walked on the calling thread (using the
+// iterative verifier) up to any vector of at least "min_split" tables. The
+// elements of those vectors are then split into ranges which are verified
+// concurrently, each thread counting the tables it sees towards what remains
+// of "max_tables". Elements of those vectors don't get split any further.
+// Verifier::VerifySharedObjectsOnce() is not supported, since the set of
+// visited objects would have to be shared between threads.
+class ParallelVerifier {
+ public:
+  // "num_threads" includes the calling thread, 0 means one per core.
+  ParallelVerifier(const uint8_t *buf, size_t buf_len, size_t max_depth = 64,
+                   size_t max_tables = 1000000, size_t num_threads = 0,
+                   size_t min_split = 1024)
+    : buf_(buf), buf_len_(buf_len), max_depth_(max_depth),
+      max_tables_(max_tables),
+      num_threads_(num_threads ? num_threads
+                               : std::thread::hardware_concurrency()),
+      min_split_(min_split), num_tables_(0) {
+    if (!num_threads_) num_threads_ = 1;
+  }
+
+  // Verify this whole buffer, starting with root type T.
+  template<typename T> bool VerifyBuffer() {
+    Verifier verifier(buf_, buf_len_, max_depth_, max_tables_);
+    std::vector<Verifier::DeferredVector> deferred;
+    if (num_threads_ > 1) verifier.DeferVectorsOfTables(&deferred, min_split_);
+    if (!verifier.VerifyBufferIteratively<T>()) return false;
+    num_tables_ = verifier.num_tables();
+    if (deferred.empty()) return true;
+
+    // Cut the deferred vectors into a few ranges per thread, such that
+    // threads that happen to get cheap ranges pick up more of them.
+    std::vector<range> ranges;
+    for (auto it = deferred.begin(); it != deferred.end(); ++it) {
+      auto size = ReadScalar<uoffset_t>(it->vec);
+      auto step = (std::max)(size / static_cast<uoffset_t>(num_threads_ * 4),
+                             static_cast<uoffset_t>(1));
+      for (uoffset_t begin = 0; begin < size; begin += step) {
+        range r = { &*it, begin, (std::min)(size - begin, step) + begin };
+        ranges.push_back(r);
+      }
+    }
+
+    auto remaining_tables = max_tables_ - num_tables_;
+    std::atomic<size_t> next_range(0);
+    std::atomic<size_t> num_tables(num_tables_);
+    std::atomic<bool> ok(true);
+    auto work = [&]() {
+      Verifier range_verifier(buf_, buf_len_, max_depth_, remaining_tables);
+      for (;;) {
+        size_t i = next_range++;
+        if (i >= ranges.size() || !ok) break;
+        auto &r = ranges[i];
+        if (!range_verifier.VerifyVectorOfTablesIteratively(
+               r.vec->vec, r.begin, r.end, r.vec->desc, r.vec->depth)) {
+          ok = false;
+          break;
+        }
+      }
+      num_tables += range_verifier.num_tables();
+    };
+    std::vector<std::thread> threads;
+    auto num_threads = (std::min)(num_threads_, ranges.size());
+    for (size_t i = 1; i < num_threads; i++) {
+      threads.push_back(std::thread(work));
+    }
+    work();
+    for (auto it = threads.begin(); it != threads.end(); ++it) it->join();
+
+    num_tables_ = num_tables;
+    return ok && verifier.Check(num_tables_ <= max_tables_);
+  }
+
+  // The number of tables verified by the last VerifyBuffer(), over all
+  // threads.
+  size_t num_tables() const { return num_tables_; }
+
+ private:
+  struct range {
+    const Verifier::DeferredVector *vec;
+    uoffset_t begin;
+    uoffset_t end;
+  };
+
+  const uint8_t *buf_;
+  size_t buf_len_;
+  size_t max_depth_;
+  size_t max_tables_;
+  size_t num_threads_;
+  size_t min_split_;
+  size_t num_tables_;
+};
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_PARALLEL_VERIFIER_H_
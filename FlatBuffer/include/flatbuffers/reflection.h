@@ -33,7 +33,9 @@ namespace flatbuffers {
 // Size of a basic type, don't use with structs.
 inline size_t GetTypeSize(reflection::BaseType base_type) {
   // This needs to correspond to the BaseType enum.
-  static size_t sizes[] = { 0, 1, 1, 1, 1, 2, 2, 4, 4, 8, 8, 4, 8, 4, 4, 4, 4 };
+  static size_t sizes[] = { 0, 1, 1, 1, 1, 2, 2, 4, 4, 8, 8, 4, 8,
+                            sizeof(uoffset_t), sizeof(uoffset_t),
+                            sizeof(uoffset_t), sizeof(uoffset_t) };
   return sizes[base_type];
 }
 
@@ -407,6 +409,47 @@ inline bool SetFieldT(Table *table, const reflection::Field &field,
   return table->SetPointer(field.offset(), val);
 }
 
+// ------------------------- VERIFYING -------------------------
+
+// Verifies buffers of any type in a schema loaded at runtime, without needing
+// generated code. Builds a verification plan for all tables of the schema up
+// front (the same descriptors flatc generates for
+// Verifier::VerifyBufferIteratively()), so construct one per schema and reuse
+// it for all buffers. The schema must outlive it.
+class SchemaVerifier {
+ public:
+  explicit SchemaVerifier(const reflection::Schema &schema);
+
+  // Verify a buffer whose root is of table type "root", which must be one of
+  // the objects of the schema (e.g. schema.root_table()).
+  bool VerifyBuffer(const reflection::Object &root, const uint8_t *buf,
+                    size_t length, size_t max_depth = 64,
+                    size_t max_tables = 1000000) const;
+
+  // The plan for a table type, for use with Verifier::VerifyTableIteratively().
+  // Returns nullptr for structs or objects not in the schema.
+  const TableVerifyDesc *GetDescriptor(const reflection::Object &obj) const;
+
+ private:
+  SchemaVerifier(const SchemaVerifier &);
+  SchemaVerifier &operator=(const SchemaVerifier &);
+
+  // Index into schema.objects(), or its size if not found.
+  uoffset_t ObjectIndex(const char *name) const;
+
+  const reflection::Schema &schema_;
+  std::vector<TableVerifyDesc> tables_;  // Indexed like schema.objects().
+  std::vector<FieldVerifyDesc> fields_;
+  std::vector<const TableVerifyDesc *> links_;
+};
+
+// Verify a buffer using only its schema. This builds a plan for the whole
+// schema on every call, use a SchemaVerifier to verify many buffers.
+bool VerifyBuffer(const reflection::Schema &schema,
+                  const reflection::Object &root, const uint8_t *buf,
+                  size_t length, size_t max_depth = 64,
+                  size_t max_tables = 1000000);
+
 // ------------------------- COPYING -------------------------
 
 // Generic copying of tables from a FlatBuffer into a FlatBuffer builder.
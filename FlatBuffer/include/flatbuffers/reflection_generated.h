@@ -57,8 +57,11 @@ struct Type FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_INDEX = 8
   };
   BaseType base_type() const { return static_cast<BaseType>(GetField<int8_t>(VT_BASE_TYPE, 0)); }
+  static void gather_base_type(const flatbuffers::Vector<flatbuffers::Offset<Type>> &tables, int8_t *out) { flatbuffers::GatherField<int8_t>(tables, VT_BASE_TYPE, 0, out); }
   BaseType element() const { return static_cast<BaseType>(GetField<int8_t>(VT_ELEMENT, 0)); }
+  static void gather_element(const flatbuffers::Vector<flatbuffers::Offset<Type>> &tables, int8_t *out) { flatbuffers::GatherField<int8_t>(tables, VT_ELEMENT, 0, out); }
   int32_t index() const { return GetField<int32_t>(VT_INDEX, -1); }
+  static void gather_index(const flatbuffers::Vector<flatbuffers::Offset<Type>> &tables, int32_t *out) { flatbuffers::GatherField<int32_t>(tables, VT_INDEX, -1, out); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int8_t>(verifier, VT_BASE_TYPE) &&
@@ -66,6 +69,7 @@ struct Type FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyField<int32_t>(verifier, VT_INDEX) &&
            verifier.EndTable();
   }
+  static const flatbuffers::TableVerifyDesc *VerifyDescriptor();
 };
 
 struct TypeBuilder {
@@ -80,6 +84,9 @@ struct TypeBuilder {
     auto o = flatbuffers::Offset<Type>(fbb_.EndTable(start_, 3));
     return o;
   }
+  flatbuffers::Offset<Type> FinishShared() {
+    return flatbuffers::Offset<Type>(fbb_.EndSharedTable(start_, 3));
+  }
 };
 
 inline flatbuffers::Offset<Type> CreateType(flatbuffers::FlatBufferBuilder &_fbb,
@@ -93,6 +100,36 @@ inline flatbuffers::Offset<Type> CreateType(flatbuffers::FlatBufferBuilder &_fbb
   return builder_.Finish();
 }
 
+inline flatbuffers::Offset<Type> CreateSharedType(flatbuffers::FlatBufferBuilder &_fbb,
+   BaseType base_type = None,
+   BaseType element = None,
+   int32_t index = -1) {
+  _fbb.StartSharedTable(4);
+  TypeBuilder builder_(_fbb);
+  builder_.add_index(index);
+  builder_.add_element(element);
+  builder_.add_base_type(base_type);
+  return builder_.FinishShared();
+}
+
+inline size_t TypeSizeBound() {
+  return 18 + 2 * sizeof(flatbuffers::uoffset_t);
+}
+
+#ifndef FLATBUFFERS_64BIT_OFFSETS  // Laid out for 32bit offsets.
+inline flatbuffers::Offset<Type> CreateTypeDirect(flatbuffers::FlatBufferBuilder &_fbb,
+   BaseType base_type,
+   BaseType element,
+   int32_t index) {
+  static const uint8_t _vtable[] = { 10, 0, 12, 0, 8, 0, 9, 0, 4, 0 };
+  auto _table = _fbb.StartDirectTable(12, 4);
+  _fbb.AddDirectElement<int32_t>(_table, 4, index);
+  _fbb.AddDirectElement<int8_t>(_table, 8, static_cast<int8_t>(base_type));
+  _fbb.AddDirectElement<int8_t>(_table, 9, static_cast<int8_t>(element));
+  return flatbuffers::Offset<Type>(_fbb.EndDirectTable(_table, _vtable, 3608016174U));
+}
+#endif
+
 struct KeyValue FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   enum {
     VT_KEY = 4,
@@ -101,6 +138,7 @@ struct KeyValue FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::String *key() const { return GetPointer<const flatbuffers::String *>(VT_KEY); }
   bool KeyCompareLessThan(const KeyValue *o) const { return *key() < *o->key(); }
   int KeyCompareWithValue(const char *val) const { return strcmp(key()->c_str(), val); }
+  const flatbuffers::String *GetKeyValue() const { return key(); }
   const flatbuffers::String *value() const { return GetPointer<const flatbuffers::String *>(VT_VALUE); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
@@ -110,6 +148,7 @@ struct KeyValue FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            verifier.Verify(value()) &&
            verifier.EndTable();
   }
+  static const flatbuffers::TableVerifyDesc *VerifyDescriptor();
 };
 
 struct KeyValueBuilder {
@@ -135,6 +174,25 @@ inline flatbuffers::Offset<KeyValue> CreateKeyValue(flatbuffers::FlatBufferBuild
   return builder_.Finish();
 }
 
+inline size_t KeyValueSizeBound(size_t key_len = 0,
+   size_t value_len = 0) {
+  return 5 + 6 * sizeof(flatbuffers::uoffset_t) +
+    flatbuffers::StringSizeBound(key_len) +
+    flatbuffers::StringSizeBound(value_len);
+}
+
+#ifndef FLATBUFFERS_64BIT_OFFSETS  // Laid out for 32bit offsets.
+inline flatbuffers::Offset<KeyValue> CreateKeyValueDirect(flatbuffers::FlatBufferBuilder &_fbb,
+   flatbuffers::Offset<flatbuffers::String> key,
+   flatbuffers::Offset<flatbuffers::String> value) {
+  static const uint8_t _vtable[] = { 8, 0, 12, 0, 4, 0, 8, 0 };
+  auto _table = _fbb.StartDirectTable(12, 4);
+  _fbb.AddDirectOffset(_table, 4, key);
+  _fbb.AddDirectOffset(_table, 8, value);
+  return flatbuffers::Offset<KeyValue>(_fbb.EndDirectTable(_table, _vtable, 2296476493U));
+}
+#endif
+
 struct EnumVal FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   enum {
     VT_NAME = 4,
@@ -143,8 +201,10 @@ struct EnumVal FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   };
   const flatbuffers::String *name() const { return GetPointer<const flatbuffers::String *>(VT_NAME); }
   int64_t value() const { return GetField<int64_t>(VT_VALUE, 0); }
+  static void gather_value(const flatbuffers::Vector<flatbuffers::Offset<EnumVal>> &tables, int64_t *out) { flatbuffers::GatherField<int64_t>(tables, VT_VALUE, 0, out); }
   bool KeyCompareLessThan(const EnumVal *o) const { return value() < o->value(); }
   int KeyCompareWithValue(int64_t val) const { return value() < val ? -1 : value() > val; }
+  int64_t GetKeyValue() const { return static_cast<int64_t>(value()); }
   const Object *object() const { return GetPointer<const Object *>(VT_OBJECT); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
@@ -155,6 +215,7 @@ struct EnumVal FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            verifier.VerifyTable(object()) &&
            verifier.EndTable();
   }
+  static const flatbuffers::TableVerifyDesc *VerifyDescriptor();
 };
 
 struct EnumValBuilder {
@@ -183,6 +244,25 @@ inline flatbuffers::Offset<EnumVal> CreateEnumVal(flatbuffers::FlatBufferBuilder
   return builder_.Finish();
 }
 
+inline size_t EnumValSizeBound(size_t name_len = 0) {
+  return 22 + 6 * sizeof(flatbuffers::uoffset_t) +
+    flatbuffers::StringSizeBound(name_len);
+}
+
+#ifndef FLATBUFFERS_64BIT_OFFSETS  // Laid out for 32bit offsets.
+inline flatbuffers::Offset<EnumVal> CreateEnumValDirect(flatbuffers::FlatBufferBuilder &_fbb,
+   flatbuffers::Offset<flatbuffers::String> name,
+   int64_t value,
+   flatbuffers::Offset<Object> object) {
+  static const uint8_t _vtable[] = { 10, 0, 24, 0, 4, 0, 8, 0, 16, 0 };
+  auto _table = _fbb.StartDirectTable(24, 8);
+  _fbb.AddDirectElement<int64_t>(_table, 8, value);
+  _fbb.AddDirectOffset(_table, 4, name);
+  _fbb.AddDirectOffset(_table, 16, object);
+  return flatbuffers::Offset<EnumVal>(_fbb.EndDirectTable(_table, _vtable, 2748875235U));
+}
+#endif
+
 struct Enum FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   enum {
     VT_NAME = 4,
@@ -194,8 +274,10 @@ struct Enum FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::String *name() const { return GetPointer<const flatbuffers::String *>(VT_NAME); }
   bool KeyCompareLessThan(const Enum *o) const { return *name() < *o->name(); }
   int KeyCompareWithValue(const char *val) const { return strcmp(name()->c_str(), val); }
+  const flatbuffers::String *GetKeyValue() const { return name(); }
   const flatbuffers::Vector<flatbuffers::Offset<EnumVal>> *values() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<EnumVal>> *>(VT_VALUES); }
   bool is_union() const { return GetField<uint8_t>(VT_IS_UNION, 0) != 0; }
+  static void gather_is_union(const flatbuffers::Vector<flatbuffers::Offset<Enum>> &tables, uint8_t *out) { flatbuffers::GatherField<uint8_t>(tables, VT_IS_UNION, 0, out); }
   const Type *underlying_type() const { return GetPointer<const Type *>(VT_UNDERLYING_TYPE); }
   const flatbuffers::Vector<flatbuffers::Offset<KeyValue>> *attributes() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<KeyValue>> *>(VT_ATTRIBUTES); }
   bool Verify(flatbuffers::Verifier &verifier) const {
@@ -213,6 +295,7 @@ struct Enum FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            verifier.VerifyVectorOfTables(attributes()) &&
            verifier.EndTable();
   }
+  static const flatbuffers::TableVerifyDesc *VerifyDescriptor();
 };
 
 struct EnumBuilder {
@@ -249,6 +332,33 @@ inline flatbuffers::Offset<Enum> CreateEnum(flatbuffers::FlatBufferBuilder &_fbb
   return builder_.Finish();
 }
 
+inline size_t EnumSizeBound(size_t name_len = 0,
+   size_t values_len = 0,
+   size_t attributes_len = 0) {
+  return 10 + 10 * sizeof(flatbuffers::uoffset_t) +
+    flatbuffers::StringSizeBound(name_len) +
+    flatbuffers::VectorSizeBound(values_len, sizeof(flatbuffers::uoffset_t), sizeof(flatbuffers::uoffset_t)) +
+    flatbuffers::VectorSizeBound(attributes_len, sizeof(flatbuffers::uoffset_t), sizeof(flatbuffers::uoffset_t));
+}
+
+#ifndef FLATBUFFERS_64BIT_OFFSETS  // Laid out for 32bit offsets.
+inline flatbuffers::Offset<Enum> CreateEnumDirect(flatbuffers::FlatBufferBuilder &_fbb,
+   flatbuffers::Offset<flatbuffers::String> name,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<EnumVal>>> values,
+   bool is_union,
+   flatbuffers::Offset<Type> underlying_type,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<KeyValue>>> attributes) {
+  static const uint8_t _vtable[] = { 14, 0, 24, 0, 4, 0, 8, 0, 20, 0, 12, 0, 16, 0 };
+  auto _table = _fbb.StartDirectTable(24, 4);
+  _fbb.AddDirectOffset(_table, 4, name);
+  _fbb.AddDirectOffset(_table, 8, values);
+  _fbb.AddDirectOffset(_table, 12, underlying_type);
+  _fbb.AddDirectOffset(_table, 16, attributes);
+  _fbb.AddDirectElement<uint8_t>(_table, 20, static_cast<uint8_t>(is_union));
+  return flatbuffers::Offset<Enum>(_fbb.EndDirectTable(_table, _vtable, 4289639535U));
+}
+#endif
+
 struct Field FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   enum {
     VT_NAME = 4,
@@ -265,14 +375,22 @@ struct Field FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::String *name() const { return GetPointer<const flatbuffers::String *>(VT_NAME); }
   bool KeyCompareLessThan(const Field *o) const { return *name() < *o->name(); }
   int KeyCompareWithValue(const char *val) const { return strcmp(name()->c_str(), val); }
+  const flatbuffers::String *GetKeyValue() const { return name(); }
   const Type *type() const { return GetPointer<const Type *>(VT_TYPE); }
   uint16_t id() const { return GetField<uint16_t>(VT_ID, 0); }
+  static void gather_id(const flatbuffers::Vector<flatbuffers::Offset<Field>> &tables, uint16_t *out) { flatbuffers::GatherField<uint16_t>(tables, VT_ID, 0, out); }
   uint16_t offset() const { return GetField<uint16_t>(VT_OFFSET, 0); }
+  static void gather_offset(const flatbuffers::Vector<flatbuffers::Offset<Field>> &tables, uint16_t *out) { flatbuffers::GatherField<uint16_t>(tables, VT_OFFSET, 0, out); }
   int64_t default_integer() const { return GetField<int64_t>(VT_DEFAULT_INTEGER, 0); }
+  static void gather_default_integer(const flatbuffers::Vector<flatbuffers::Offset<Field>> &tables, int64_t *out) { flatbuffers::GatherField<int64_t>(tables, VT_DEFAULT_INTEGER, 0, out); }
   double default_real() const { return GetField<double>(VT_DEFAULT_REAL, 0.0); }
+  static void gather_default_real(const flatbuffers::Vector<flatbuffers::Offset<Field>> &tables, double *out) { flatbuffers::GatherField<double>(tables, VT_DEFAULT_REAL, 0.0, out); }
   bool deprecated() const { return GetField<uint8_t>(VT_DEPRECATED, 0) != 0; }
+  static void gather_deprecated(const flatbuffers::Vector<flatbuffers::Offset<Field>> &tables, uint8_t *out) { flatbuffers::GatherField<uint8_t>(tables, VT_DEPRECATED, 0, out); }
   bool required() const { return GetField<uint8_t>(VT_REQUIRED, 0) != 0; }
+  static void gather_required(const flatbuffers::Vector<flatbuffers::Offset<Field>> &tables, uint8_t *out) { flatbuffers::GatherField<uint8_t>(tables, VT_REQUIRED, 0, out); }
   bool key() const { return GetField<uint8_t>(VT_KEY, 0) != 0; }
+  static void gather_key(const flatbuffers::Vector<flatbuffers::Offset<Field>> &tables, uint8_t *out) { flatbuffers::GatherField<uint8_t>(tables, VT_KEY, 0, out); }
   const flatbuffers::Vector<flatbuffers::Offset<KeyValue>> *attributes() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<KeyValue>> *>(VT_ATTRIBUTES); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
@@ -292,6 +410,7 @@ struct Field FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            verifier.VerifyVectorOfTables(attributes()) &&
            verifier.EndTable();
   }
+  static const flatbuffers::TableVerifyDesc *VerifyDescriptor();
 };
 
 struct FieldBuilder {
@@ -342,6 +461,41 @@ inline flatbuffers::Offset<Field> CreateField(flatbuffers::FlatBufferBuilder &_f
   return builder_.Finish();
 }
 
+inline size_t FieldSizeBound(size_t name_len = 0,
+   size_t attributes_len = 0) {
+  return 59 + 8 * sizeof(flatbuffers::uoffset_t) +
+    flatbuffers::StringSizeBound(name_len) +
+    flatbuffers::VectorSizeBound(attributes_len, sizeof(flatbuffers::uoffset_t), sizeof(flatbuffers::uoffset_t));
+}
+
+#ifndef FLATBUFFERS_64BIT_OFFSETS  // Laid out for 32bit offsets.
+inline flatbuffers::Offset<Field> CreateFieldDirect(flatbuffers::FlatBufferBuilder &_fbb,
+   flatbuffers::Offset<flatbuffers::String> name,
+   flatbuffers::Offset<Type> type,
+   uint16_t id,
+   uint16_t offset,
+   int64_t default_integer,
+   double default_real,
+   bool deprecated,
+   bool required,
+   bool key,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<KeyValue>>> attributes) {
+  static const uint8_t _vtable[] = { 24, 0, 40, 0, 4, 0, 24, 0, 32, 0, 34, 0, 8, 0, 16, 0, 36, 0, 37, 0, 38, 0, 28, 0 };
+  auto _table = _fbb.StartDirectTable(40, 8);
+  _fbb.AddDirectElement<int64_t>(_table, 8, default_integer);
+  _fbb.AddDirectElement<double>(_table, 16, default_real);
+  _fbb.AddDirectOffset(_table, 4, name);
+  _fbb.AddDirectOffset(_table, 24, type);
+  _fbb.AddDirectOffset(_table, 28, attributes);
+  _fbb.AddDirectElement<uint16_t>(_table, 32, id);
+  _fbb.AddDirectElement<uint16_t>(_table, 34, offset);
+  _fbb.AddDirectElement<uint8_t>(_table, 36, static_cast<uint8_t>(deprecated));
+  _fbb.AddDirectElement<uint8_t>(_table, 37, static_cast<uint8_t>(required));
+  _fbb.AddDirectElement<uint8_t>(_table, 38, static_cast<uint8_t>(key));
+  return flatbuffers::Offset<Field>(_fbb.EndDirectTable(_table, _vtable, 2092460016U));
+}
+#endif
+
 struct Object FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   enum {
     VT_NAME = 4,
@@ -354,10 +508,14 @@ struct Object FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::String *name() const { return GetPointer<const flatbuffers::String *>(VT_NAME); }
   bool KeyCompareLessThan(const Object *o) const { return *name() < *o->name(); }
   int KeyCompareWithValue(const char *val) const { return strcmp(name()->c_str(), val); }
+  const flatbuffers::String *GetKeyValue() const { return name(); }
   const flatbuffers::Vector<flatbuffers::Offset<Field>> *fields() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Field>> *>(VT_FIELDS); }
   bool is_struct() const { return GetField<uint8_t>(VT_IS_STRUCT, 0) != 0; }
+  static void gather_is_struct(const flatbuffers::Vector<flatbuffers::Offset<Object>> &tables, uint8_t *out) { flatbuffers::GatherField<uint8_t>(tables, VT_IS_STRUCT, 0, out); }
   int32_t minalign() const { return GetField<int32_t>(VT_MINALIGN, 0); }
+  static void gather_minalign(const flatbuffers::Vector<flatbuffers::Offset<Object>> &tables, int32_t *out) { flatbuffers::GatherField<int32_t>(tables, VT_MINALIGN, 0, out); }
   int32_t bytesize() const { return GetField<int32_t>(VT_BYTESIZE, 0); }
+  static void gather_bytesize(const flatbuffers::Vector<flatbuffers::Offset<Object>> &tables, int32_t *out) { flatbuffers::GatherField<int32_t>(tables, VT_BYTESIZE, 0, out); }
   const flatbuffers::Vector<flatbuffers::Offset<KeyValue>> *attributes() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<KeyValue>> *>(VT_ATTRIBUTES); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
@@ -374,6 +532,7 @@ struct Object FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            verifier.VerifyVectorOfTables(attributes()) &&
            verifier.EndTable();
   }
+  static const flatbuffers::TableVerifyDesc *VerifyDescriptor();
 };
 
 struct ObjectBuilder {
@@ -412,6 +571,35 @@ inline flatbuffers::Offset<Object> CreateObject(flatbuffers::FlatBufferBuilder &
   return builder_.Finish();
 }
 
+inline size_t ObjectSizeBound(size_t name_len = 0,
+   size_t fields_len = 0,
+   size_t attributes_len = 0) {
+  return 27 + 8 * sizeof(flatbuffers::uoffset_t) +
+    flatbuffers::StringSizeBound(name_len) +
+    flatbuffers::VectorSizeBound(fields_len, sizeof(flatbuffers::uoffset_t), sizeof(flatbuffers::uoffset_t)) +
+    flatbuffers::VectorSizeBound(attributes_len, sizeof(flatbuffers::uoffset_t), sizeof(flatbuffers::uoffset_t));
+}
+
+#ifndef FLATBUFFERS_64BIT_OFFSETS  // Laid out for 32bit offsets.
+inline flatbuffers::Offset<Object> CreateObjectDirect(flatbuffers::FlatBufferBuilder &_fbb,
+   flatbuffers::Offset<flatbuffers::String> name,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Field>>> fields,
+   bool is_struct,
+   int32_t minalign,
+   int32_t bytesize,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<KeyValue>>> attributes) {
+  static const uint8_t _vtable[] = { 16, 0, 28, 0, 4, 0, 8, 0, 24, 0, 12, 0, 16, 0, 20, 0 };
+  auto _table = _fbb.StartDirectTable(28, 4);
+  _fbb.AddDirectOffset(_table, 4, name);
+  _fbb.AddDirectOffset(_table, 8, fields);
+  _fbb.AddDirectElement<int32_t>(_table, 12, minalign);
+  _fbb.AddDirectElement<int32_t>(_table, 16, bytesize);
+  _fbb.AddDirectOffset(_table, 20, attributes);
+  _fbb.AddDirectElement<uint8_t>(_table, 24, static_cast<uint8_t>(is_struct));
+  return flatbuffers::Offset<Object>(_fbb.EndDirectTable(_table, _vtable, 3168342405U));
+}
+#endif
+
 struct Schema FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   enum {
     VT_OBJECTS = 4,
@@ -441,6 +629,7 @@ struct Schema FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            verifier.VerifyTable(root_table()) &&
            verifier.EndTable();
   }
+  static const flatbuffers::TableVerifyDesc *VerifyDescriptor();
 };
 
 struct SchemaBuilder {
@@ -476,10 +665,126 @@ inline flatbuffers::Offset<Schema> CreateSchema(flatbuffers::FlatBufferBuilder &
   return builder_.Finish();
 }
 
+inline size_t SchemaSizeBound(size_t objects_len = 0,
+   size_t enums_len = 0,
+   size_t file_ident_len = 0,
+   size_t file_ext_len = 0) {
+  return 8 + 12 * sizeof(flatbuffers::uoffset_t) +
+    flatbuffers::VectorSizeBound(objects_len, sizeof(flatbuffers::uoffset_t), sizeof(flatbuffers::uoffset_t)) +
+    flatbuffers::VectorSizeBound(enums_len, sizeof(flatbuffers::uoffset_t), sizeof(flatbuffers::uoffset_t)) +
+    flatbuffers::StringSizeBound(file_ident_len) +
+    flatbuffers::StringSizeBound(file_ext_len);
+}
+
+#ifndef FLATBUFFERS_64BIT_OFFSETS  // Laid out for 32bit offsets.
+inline flatbuffers::Offset<Schema> CreateSchemaDirect(flatbuffers::FlatBufferBuilder &_fbb,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Object>>> objects,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Enum>>> enums,
+   flatbuffers::Offset<flatbuffers::String> file_ident,
+   flatbuffers::Offset<flatbuffers::String> file_ext,
+   flatbuffers::Offset<Object> root_table) {
+  static const uint8_t _vtable[] = { 14, 0, 24, 0, 4, 0, 8, 0, 12, 0, 16, 0, 20, 0 };
+  auto _table = _fbb.StartDirectTable(24, 4);
+  _fbb.AddDirectOffset(_table, 4, objects);
+  _fbb.AddDirectOffset(_table, 8, enums);
+  _fbb.AddDirectOffset(_table, 12, file_ident);
+  _fbb.AddDirectOffset(_table, 16, file_ext);
+  _fbb.AddDirectOffset(_table, 20, root_table);
+  return flatbuffers::Offset<Schema>(_fbb.EndDirectTable(_table, _vtable, 4207545599U));
+}
+#endif
+
+inline const flatbuffers::TableVerifyDesc *Type::VerifyDescriptor() {
+  static const flatbuffers::FieldVerifyDesc fields[] = {
+    { VT_BASE_TYPE, "base_type", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int8_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_ELEMENT, "element", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int8_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_INDEX, "index", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int32_t), nullptr, 0, nullptr, 0, nullptr }
+  };
+  static const flatbuffers::TableVerifyDesc desc = { fields, 3 };
+  return &desc;
+}
+
+inline const flatbuffers::TableVerifyDesc *KeyValue::VerifyDescriptor() {
+  static const flatbuffers::FieldVerifyDesc fields[] = {
+    { VT_KEY, "key", flatbuffers::FieldVerifyDesc::kString, true, 0, nullptr, 0, nullptr, 0, nullptr },
+    { VT_VALUE, "value", flatbuffers::FieldVerifyDesc::kString, false, 0, nullptr, 0, nullptr, 0, nullptr }
+  };
+  static const flatbuffers::TableVerifyDesc desc = { fields, 2 };
+  return &desc;
+}
+
+inline const flatbuffers::TableVerifyDesc *EnumVal::VerifyDescriptor() {
+  static const flatbuffers::FieldVerifyDesc fields[] = {
+    { VT_NAME, "name", flatbuffers::FieldVerifyDesc::kString, true, 0, nullptr, 0, nullptr, 0, nullptr },
+    { VT_VALUE, "value", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int64_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_OBJECT, "object", flatbuffers::FieldVerifyDesc::kTable, false, 0, &Object::VerifyDescriptor, 0, nullptr, 0, nullptr }
+  };
+  static const flatbuffers::TableVerifyDesc desc = { fields, 3 };
+  return &desc;
+}
+
+inline const flatbuffers::TableVerifyDesc *Enum::VerifyDescriptor() {
+  static const flatbuffers::FieldVerifyDesc fields[] = {
+    { VT_NAME, "name", flatbuffers::FieldVerifyDesc::kString, true, 0, nullptr, 0, nullptr, 0, nullptr },
+    { VT_VALUES, "values", flatbuffers::FieldVerifyDesc::kVectorOfTables, true, 0, &EnumVal::VerifyDescriptor, 0, nullptr, 0, nullptr },
+    { VT_IS_UNION, "is_union", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(uint8_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_UNDERLYING_TYPE, "underlying_type", flatbuffers::FieldVerifyDesc::kTable, true, 0, &Type::VerifyDescriptor, 0, nullptr, 0, nullptr },
+    { VT_ATTRIBUTES, "attributes", flatbuffers::FieldVerifyDesc::kVectorOfTables, false, 0, &KeyValue::VerifyDescriptor, 0, nullptr, 0, nullptr }
+  };
+  static const flatbuffers::TableVerifyDesc desc = { fields, 5 };
+  return &desc;
+}
+
+inline const flatbuffers::TableVerifyDesc *Field::VerifyDescriptor() {
+  static const flatbuffers::FieldVerifyDesc fields[] = {
+    { VT_NAME, "name", flatbuffers::FieldVerifyDesc::kString, true, 0, nullptr, 0, nullptr, 0, nullptr },
+    { VT_TYPE, "type", flatbuffers::FieldVerifyDesc::kTable, true, 0, &Type::VerifyDescriptor, 0, nullptr, 0, nullptr },
+    { VT_ID, "id", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(uint16_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_OFFSET, "offset", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(uint16_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_DEFAULT_INTEGER, "default_integer", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int64_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_DEFAULT_REAL, "default_real", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(double), nullptr, 0, nullptr, 0, nullptr },
+    { VT_DEPRECATED, "deprecated", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(uint8_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_REQUIRED, "required", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(uint8_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_KEY, "key", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(uint8_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_ATTRIBUTES, "attributes", flatbuffers::FieldVerifyDesc::kVectorOfTables, false, 0, &KeyValue::VerifyDescriptor, 0, nullptr, 0, nullptr }
+  };
+  static const flatbuffers::TableVerifyDesc desc = { fields, 10 };
+  return &desc;
+}
+
+inline const flatbuffers::TableVerifyDesc *Object::VerifyDescriptor() {
+  static const flatbuffers::FieldVerifyDesc fields[] = {
+    { VT_NAME, "name", flatbuffers::FieldVerifyDesc::kString, true, 0, nullptr, 0, nullptr, 0, nullptr },
+    { VT_FIELDS, "fields", flatbuffers::FieldVerifyDesc::kVectorOfTables, true, 0, &Field::VerifyDescriptor, 0, nullptr, 0, nullptr },
+    { VT_IS_STRUCT, "is_struct", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(uint8_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_MINALIGN, "minalign", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int32_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_BYTESIZE, "bytesize", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int32_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_ATTRIBUTES, "attributes", flatbuffers::FieldVerifyDesc::kVectorOfTables, false, 0, &KeyValue::VerifyDescriptor, 0, nullptr, 0, nullptr }
+  };
+  static const flatbuffers::TableVerifyDesc desc = { fields, 6 };
+  return &desc;
+}
+
+inline const flatbuffers::TableVerifyDesc *Schema::VerifyDescriptor() {
+  static const flatbuffers::FieldVerifyDesc fields[] = {
+    { VT_OBJECTS, "objects", flatbuffers::FieldVerifyDesc::kVectorOfTables, true, 0, &Object::VerifyDescriptor, 0, nullptr, 0, nullptr },
+    { VT_ENUMS, "enums", flatbuffers::FieldVerifyDesc::kVectorOfTables, true, 0, &Enum::VerifyDescriptor, 0, nullptr, 0, nullptr },
+    { VT_FILE_IDENT, "file_ident", flatbuffers::FieldVerifyDesc::kString, false, 0, nullptr, 0, nullptr, 0, nullptr },
+    { VT_FILE_EXT, "file_ext", flatbuffers::FieldVerifyDesc::kString, false, 0, nullptr, 0, nullptr, 0, nullptr },
+    { VT_ROOT_TABLE, "root_table", flatbuffers::FieldVerifyDesc::kTable, false, 0, &Object::VerifyDescriptor, 0, nullptr, 0, nullptr }
+  };
+  static const flatbuffers::TableVerifyDesc desc = { fields, 5 };
+  return &desc;
+}
+
 inline const reflection::Schema *GetSchema(const void *buf) { return flatbuffers::GetRoot<reflection::Schema>(buf); }
 
+inline const reflection::Schema *GetSizePrefixedSchema(const void *buf) { return flatbuffers::GetSizePrefixedRoot<reflection::Schema>(buf); }
+
 inline bool VerifySchemaBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifyBuffer<reflection::Schema>(); }
 
+inline bool VerifySizePrefixedSchemaBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifySizePrefixedBuffer<reflection::Schema>(); }
+
 inline const char *SchemaIdentifier() { return "BFBS"; }
 
 inline bool SchemaBufferHasIdentifier(const void *buf) { return flatbuffers::BufferHasIdentifier(buf, SchemaIdentifier()); }
@@ -488,6 +793,8 @@ inline const char *SchemaExtension() { return "bfbs"; }
 
 inline void FinishSchemaBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<reflection::Schema> root) { fbb.Finish(root, SchemaIdentifier()); }
 
+inline void FinishSizePrefixedSchemaBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<reflection::Schema> root) { fbb.FinishSizePrefixed(root, SchemaIdentifier()); }
+
 }  // namespace reflection
 
 #endif  // FLATBUFFERS_GENERATED_REFLECTION_REFLECTION_H_
@@ -5,12 +5,13 @@
 
 #include "flatbuffers/flatbuffers.h"
 
-
 namespace MyGame {
 namespace Sample {
 
 struct Vec3;
+
 struct Monster;
+
 struct Weapon;
 
 enum Color {
@@ -74,12 +75,16 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   };
   const Vec3 *pos() const { return GetStruct<const Vec3 *>(VT_POS); }
   int16_t mana() const { return GetField<int16_t>(VT_MANA, 150); }
+  static void gather_mana(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, int16_t *out) { flatbuffers::GatherField<int16_t>(tables, VT_MANA, 150, out); }
   int16_t hp() const { return GetField<int16_t>(VT_HP, 100); }
+  static void gather_hp(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, int16_t *out) { flatbuffers::GatherField<int16_t>(tables, VT_HP, 100, out); }
   const flatbuffers::String *name() const { return GetPointer<const flatbuffers::String *>(VT_NAME); }
   const flatbuffers::Vector<uint8_t> *inventory() const { return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_INVENTORY); }
   Color color() const { return static_cast<Color>(GetField<int8_t>(VT_COLOR, 2)); }
+  static void gather_color(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, int8_t *out) { flatbuffers::GatherField<int8_t>(tables, VT_COLOR, 2, out); }
   const flatbuffers::Vector<flatbuffers::Offset<Weapon>> *weapons() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Weapon>> *>(VT_WEAPONS); }
   Equipment equipped_type() const { return static_cast<Equipment>(GetField<uint8_t>(VT_EQUIPPED_TYPE, 0)); }
+  static void gather_equipped_type(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, uint8_t *out) { flatbuffers::GatherField<uint8_t>(tables, VT_EQUIPPED_TYPE, 0, out); }
   const void *equipped() const { return GetPointer<const void *>(VT_EQUIPPED); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
@@ -99,6 +104,7 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyEquipment(verifier, equipped(), equipped_type()) &&
            verifier.EndTable();
   }
+  static const flatbuffers::TableVerifyDesc *VerifyDescriptor();
 };
 
 struct MonsterBuilder {
@@ -144,6 +150,41 @@ inline flatbuffers::Offset<Monster> CreateMonster(flatbuffers::FlatBufferBuilder
   return builder_.Finish();
 }
 
+inline size_t MonsterSizeBound(size_t name_len = 0,
+   size_t inventory_len = 0,
+   size_t weapons_len = 0) {
+  return 42 + 10 * sizeof(flatbuffers::uoffset_t) +
+    flatbuffers::StringSizeBound(name_len) +
+    flatbuffers::VectorSizeBound(inventory_len, 1, 1) +
+    flatbuffers::VectorSizeBound(weapons_len, sizeof(flatbuffers::uoffset_t), sizeof(flatbuffers::uoffset_t));
+}
+
+#ifndef FLATBUFFERS_64BIT_OFFSETS  // Laid out for 32bit offsets.
+inline flatbuffers::Offset<Monster> CreateMonsterDirect(flatbuffers::FlatBufferBuilder &_fbb,
+   const Vec3 *pos,
+   int16_t mana,
+   int16_t hp,
+   flatbuffers::Offset<flatbuffers::String> name,
+   flatbuffers::Offset<flatbuffers::Vector<uint8_t>> inventory,
+   Color color,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Weapon>>> weapons,
+   Equipment equipped_type,
+   flatbuffers::Offset<void> equipped) {
+  static const uint8_t _vtable[] = { 24, 0, 40, 0, 4, 0, 32, 0, 34, 0, 16, 0, 0, 0, 20, 0, 36, 0, 24, 0, 37, 0, 28, 0 };
+  auto _table = _fbb.StartDirectTable(40, 4);
+  _fbb.AddDirectStruct(_table, 4, pos);
+  _fbb.AddDirectOffset(_table, 16, name);
+  _fbb.AddDirectOffset(_table, 20, inventory);
+  _fbb.AddDirectOffset(_table, 24, weapons);
+  _fbb.AddDirectOffset(_table, 28, equipped);
+  _fbb.AddDirectElement<int16_t>(_table, 32, mana);
+  _fbb.AddDirectElement<int16_t>(_table, 34, hp);
+  _fbb.AddDirectElement<int8_t>(_table, 36, static_cast<int8_t>(color));
+  _fbb.AddDirectElement<uint8_t>(_table, 37, static_cast<uint8_t>(equipped_type));
+  return flatbuffers::Offset<Monster>(_fbb.EndDirectTable(_table, _vtable, 3523030946U));
+}
+#endif
+
 struct Weapon FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   enum {
     VT_NAME = 4,
@@ -151,6 +192,7 @@ struct Weapon FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   };
   const flatbuffers::String *name() const { return GetPointer<const flatbuffers::String *>(VT_NAME); }
   int16_t damage() const { return GetField<int16_t>(VT_DAMAGE, 0); }
+  static void gather_damage(const flatbuffers::Vector<flatbuffers::Offset<Weapon>> &tables, int16_t *out) { flatbuffers::GatherField<int16_t>(tables, VT_DAMAGE, 0, out); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<flatbuffers::uoffset_t>(verifier, VT_NAME) &&
@@ -158,6 +200,7 @@ struct Weapon FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyField<int16_t>(verifier, VT_DAMAGE) &&
            verifier.EndTable();
   }
+  static const flatbuffers::TableVerifyDesc *VerifyDescriptor();
 };
 
 struct WeaponBuilder {
@@ -182,20 +225,69 @@ inline flatbuffers::Offset<Weapon> CreateWeapon(flatbuffers::FlatBufferBuilder &
   return builder_.Finish();
 }
 
+inline size_t WeaponSizeBound(size_t name_len = 0) {
+  return 9 + 4 * sizeof(flatbuffers::uoffset_t) +
+    flatbuffers::StringSizeBound(name_len);
+}
+
+#ifndef FLATBUFFERS_64BIT_OFFSETS  // Laid out for 32bit offsets.
+inline flatbuffers::Offset<Weapon> CreateWeaponDirect(flatbuffers::FlatBufferBuilder &_fbb,
+   flatbuffers::Offset<flatbuffers::String> name,
+   int16_t damage) {
+  static const uint8_t _vtable[] = { 8, 0, 12, 0, 4, 0, 8, 0 };
+  auto _table = _fbb.StartDirectTable(12, 4);
+  _fbb.AddDirectOffset(_table, 4, name);
+  _fbb.AddDirectElement<int16_t>(_table, 8, damage);
+  return flatbuffers::Offset<Weapon>(_fbb.EndDirectTable(_table, _vtable, 2296476493U));
+}
+#endif
+
 inline bool VerifyEquipment(flatbuffers::Verifier &verifier, const void *union_obj, Equipment type) {
   switch (type) {
     case Equipment_NONE: return true;
     case Equipment_Weapon: return verifier.VerifyTable(reinterpret_cast<const Weapon *>(union_obj));
-    default: return false;
+    default: return verifier.Check(false, "unknown union type", union_obj);
   }
 }
 
+inline const flatbuffers::TableVerifyDesc *Monster::VerifyDescriptor() {
+  static const flatbuffers::TableVerifyDescFn equipped_tables[] = { nullptr, &Weapon::VerifyDescriptor };
+  static const flatbuffers::FieldVerifyDesc fields[] = {
+    { VT_POS, "pos", flatbuffers::FieldVerifyDesc::kStruct, false, sizeof(Vec3), nullptr, 0, nullptr, 0, nullptr },
+    { VT_MANA, "mana", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int16_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_HP, "hp", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int16_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_NAME, "name", flatbuffers::FieldVerifyDesc::kString, false, 0, nullptr, 0, nullptr, 0, nullptr },
+    { VT_INVENTORY, "inventory", flatbuffers::FieldVerifyDesc::kVector, false, sizeof(uint8_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_COLOR, "color", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int8_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_WEAPONS, "weapons", flatbuffers::FieldVerifyDesc::kVectorOfTables, false, 0, &Weapon::VerifyDescriptor, 0, nullptr, 0, nullptr },
+    { VT_EQUIPPED_TYPE, "equipped_type", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(uint8_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_EQUIPPED, "equipped", flatbuffers::FieldVerifyDesc::kUnion, false, 0, nullptr, VT_EQUIPPED_TYPE, equipped_tables, 2, nullptr }
+  };
+  static const flatbuffers::TableVerifyDesc desc = { fields, 9 };
+  return &desc;
+}
+
+inline const flatbuffers::TableVerifyDesc *Weapon::VerifyDescriptor() {
+  static const flatbuffers::FieldVerifyDesc fields[] = {
+    { VT_NAME, "name", flatbuffers::FieldVerifyDesc::kString, false, 0, nullptr, 0, nullptr, 0, nullptr },
+    { VT_DAMAGE, "damage", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int16_t), nullptr, 0, nullptr, 0, nullptr }
+  };
+  static const flatbuffers::TableVerifyDesc desc = { fields, 2 };
+  return &desc;
+}
+
 inline const MyGame::Sample::Monster *GetMonster(const void *buf) { return flatbuffers::GetRoot<MyGame::Sample::Monster>(buf); }
 
+inline const MyGame::Sample::Monster *GetSizePrefixedMonster(const void *buf) { return flatbuffers::GetSizePrefixedRoot<MyGame::Sample::Monster>(buf); }
+
 inline bool VerifyMonsterBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifyBuffer<MyGame::Sample::Monster>(); }
 
+inline bool VerifySizePrefixedMonsterBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifySizePrefixedBuffer<MyGame::Sample::Monster>(); }
+
 inline void FinishMonsterBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<MyGame::Sample::Monster> root) { fbb.Finish(root); }
 
+inline void FinishSizePrefixedMonsterBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<MyGame::Sample::Monster> root) { fbb.FinishSizePrefixed(root); }
+
 }  // namespace Sample
 }  // namespace MyGame
 
@@ -120,6 +120,10 @@ static void Error(const std::string &err, bool usage, bool show_exe_name) {
       "  --no-includes      Don\'t generate include statements for included\n"
       "                     schemas the generated file depends on (C++).\n"
       "  --gen-mutable      Generate accessors that can mutate buffers in-place.\n"
+      "  --gen-checked      Generate accessors that check untrusted buffers as\n"
+      "                     they read them (C++).\n"
+      "  --gen-vtable-cache Generate accessors that decode vtables through a\n"
+      "                     flatbuffers::VTableCache (C++).\n"
       "  --gen-onefile      Generate single output file for C#\n"
       "  --gen-name-strings Generate type name functions for C++.\n"
       "  --raw-binary       Allow binaries without file_indentifier to be read.\n"
@@ -178,6 +182,10 @@ int main(int argc, const char *argv[]) {
         opts.scoped_enums = true;
       } else if(arg == "--gen-mutable") {
         opts.mutable_buffer = true;
+      } else if(arg == "--gen-checked") {
+        opts.checked_accessors = true;
+      } else if(arg == "--gen-vtable-cache") {
+        opts.vtable_cache_accessors = true;
       } else if(arg == "--gen-name-strings") {
         opts.generate_name_strings = true;
       } else if(arg == "--gen-all") {
@@ -241,7 +241,8 @@ static void GenEnumPost(const Parser &parser, EnumDef &enum_def,
       code_post += " *>(union_obj));\n";
     }
   }
-  code_post += "    default: return false;\n  }\n}\n\n";
+  code_post += "    default: return verifier.Check(false, \"unknown union type\", ";
+  code_post += "union_obj);\n  }\n}\n\n";
 }
 
 // Generates a value with optionally a cast applied if the field has a
@@ -268,6 +269,109 @@ std::string GenFieldOffsetName(const FieldDef &field) {
   return "VT_" + uname;
 }
 
+// Generate the table of fields Verifier::VerifyBufferIteratively() walks
+// instead of calling Verify(). It mirrors the checks Verify() makes.
+static void GenTableVerifyDescriptor(const Parser &parser,
+                                     const StructDef &struct_def,
+                                     std::string *code_ptr) {
+  std::string &code = *code_ptr;
+  code += "inline const flatbuffers::TableVerifyDesc *" + struct_def.name;
+  code += "::VerifyDescriptor() {\n";
+  std::string fields;
+  size_t num_fields = 0;
+  for (auto it = struct_def.fields.vec.begin();
+       it != struct_def.fields.vec.end();
+       ++it) {
+    auto &field = **it;
+    if (field.deprecated) continue;
+    auto &type = field.value.type;
+    std::string kind, size = "0", table = "nullptr", union_type_field = "0",
+                union_tables = "nullptr", num_union_tables = "0";
+    switch (type.base_type) {
+      case BASE_TYPE_UNION: {
+        // Table descriptors indexed by union type, for unions only known
+        // by their (possibly corrupt) type field at verification time.
+        auto &enum_def = *type.enum_def;
+        code += "  static const flatbuffers::TableVerifyDescFn " + field.name;
+        code += "_tables[] = { ";
+        int64_t val = 0;
+        for (auto ev = enum_def.vals.vec.begin();
+             ev != enum_def.vals.vec.end();
+             ++ev) {
+          for (; val < (*ev)->value; val++) code += "nullptr, ";
+          code += (*ev)->value
+                    ? "&" + WrapInNameSpace(*(*ev)->struct_def) +
+                      "::VerifyDescriptor, "
+                    : "nullptr, ";
+          val++;
+        }
+        code.resize(code.size() - 2);
+        code += " };\n";
+        kind = "kUnion";
+        union_type_field = GenFieldOffsetName(field) + "_TYPE";
+        union_tables = field.name + "_tables";
+        num_union_tables = NumToString(val);
+        break;
+      }
+      case BASE_TYPE_STRUCT:
+        if (type.struct_def->fixed) {
+          kind = "kStruct";
+          size = "sizeof(" + GenTypePointer(parser, type) + ")";
+        } else {
+          kind = "kTable";
+          table = "&" + WrapInNameSpace(*type.struct_def) +
+                  "::VerifyDescriptor";
+        }
+        break;
+      case BASE_TYPE_STRING:
+        kind = "kString";
+        break;
+      case BASE_TYPE_VECTOR:
+        switch (type.element) {
+          case BASE_TYPE_STRING:
+            kind = "kVectorOfStrings";
+            break;
+          case BASE_TYPE_STRUCT:
+            if (!type.struct_def->fixed) {
+              kind = "kVectorOfTables";
+              table = "&" + WrapInNameSpace(*type.struct_def) +
+                      "::VerifyDescriptor";
+              break;
+            }
+            // Fall through.
+          default:
+            kind = "kVector";
+            size = "sizeof(" + GenTypeSize(parser, type.VectorType()) + ")";
+            break;
+        }
+        break;
+      default:
+        kind = "kScalar";
+        size = "sizeof(" + GenTypeBasic(type, false) + ")";
+        break;
+    }
+    fields += "    { " + GenFieldOffsetName(field);
+    fields += ", \"" + field.name + "\"";
+    fields += ", flatbuffers::FieldVerifyDesc::" + kind;
+    fields += std::string(", ") + (field.required ? "true" : "false");
+    fields += ", " + size + ", " + table + ", " + union_type_field;
+    fields += ", " + union_tables + ", " + num_union_tables;
+    fields += ", nullptr },\n";
+    num_fields++;
+  }
+  if (num_fields) {
+    code += "  static const flatbuffers::FieldVerifyDesc fields[] = {\n";
+    fields.resize(fields.size() - 2);
+    code += fields + "\n  };\n";
+    code += "  static const flatbuffers::TableVerifyDesc desc = { fields, ";
+    code += NumToString(num_fields) + " };\n";
+  } else {
+    code += "  static const flatbuffers::TableVerifyDesc desc = ";
+    code += "{ nullptr, 0 };\n";
+  }
+  code += "  return &desc;\n}\n\n";
+}
+
 static void GenFullyQualifiedNameGetter(const Parser &parser, const std::string& name, std::string &code) {
   if (parser.opts.generate_name_strings) {
     code += "  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {\n";
@@ -282,6 +386,126 @@ std::string GenDefaultConstant(const FieldDef &field) {
       : field.value.constant;
 }
 
+// Size (and alignment) of a field in the buffers described by this schema.
+// Offsets are 64bit for (offset64) schemas, regardless of how flatc itself
+// was built.
+static size_t WireSize(const Parser &parser, const Type &type) {
+  if (IsScalar(type.base_type) || IsStruct(type)) return InlineSize(type);
+  return parser.UsesOffset64() ? sizeof(uint64_t) : sizeof(uint32_t);
+}
+
+static size_t WireAlignment(const Parser &parser, const Type &type) {
+  if (IsScalar(type.base_type) || IsStruct(type)) return InlineAlignment(type);
+  return WireSize(parser, type);
+}
+
+// Generate a CreateXDirect function, which writes a table with all its
+// fields present. The table layout and vtable are computed here, such that
+// the builder can write fields straight into place, rather than tracking
+// them and constructing (and looking up) the vtable at runtime.
+static void GenDirectCreate(const Parser &parser, StructDef &struct_def,
+                            std::string *code_ptr) {
+  std::string &code = *code_ptr;
+  auto &fields = struct_def.fields.vec;
+  // Place the biggest fields first, each at the first free spot with the
+  // right alignment after the vtable offset.
+  std::vector<size_t> order;
+  for (size_t i = 0; i < fields.size(); i++) {
+    if (!fields[i]->deprecated) order.push_back(i);
+  }
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return WireSize(parser, fields[a]->value.type) >
+           WireSize(parser, fields[b]->value.type);
+  });
+  std::vector<size_t> field_offsets(fields.size(), 0);
+  auto soffset_size = parser.UsesOffset64() ? sizeof(int64_t)
+                                            : sizeof(int32_t);
+  std::vector<bool> used(soffset_size, true);
+  size_t table_align = soffset_size;
+  for (auto it = order.begin(); it != order.end(); ++it) {
+    auto &type = fields[*it]->value.type;
+    auto size = WireSize(parser, type);
+    auto align = WireAlignment(parser, type);
+    table_align = std::max(table_align, align);
+    size_t off = 0;
+    for (;; off += align) {
+      size_t i = off;
+      while (i < off + size && (i >= used.size() || !used[i])) i++;
+      if (i == off + size) break;
+    }
+    if (used.size() < off + size) used.resize(off + size, false);
+    for (size_t i = off; i < off + size; i++) used[i] = true;
+    field_offsets[*it] = off;
+  }
+  auto table_size = (used.size() + table_align - 1) & ~(table_align - 1);
+  if (table_size >= 0x10000) {
+    // Field offsets wouldn't fit a voffset_t, use Create<Table>() instead.
+    code += "// No Create" + struct_def.name + "Direct(): with all fields ";
+    code += "present the table would be " + NumToString(table_size);
+    code += " bytes,\n// more than a vtable can describe.\n\n";
+    return;
+  }
+
+  // The vtable, as little endian bytes.
+  std::vector<voffset_t> vtable;
+  vtable.push_back(static_cast<voffset_t>((fields.size() + 2) *
+                                          sizeof(voffset_t)));
+  vtable.push_back(static_cast<voffset_t>(table_size));
+  for (size_t i = 0; i < fields.size(); i++) {
+    vtable.push_back(static_cast<voffset_t>(field_offsets[i]));
+  }
+  std::vector<uint8_t> vtable_bytes;
+  for (auto it = vtable.begin(); it != vtable.end(); ++it) {
+    vtable_bytes.push_back(static_cast<uint8_t>(*it & 0xFF));
+    vtable_bytes.push_back(static_cast<uint8_t>(*it >> 8));
+  }
+  auto hash = HashBytes(vtable_bytes.data(), vtable_bytes.size());
+
+  // The layout above depends on the offset size. (offset64) schemas check it
+  // for the whole header, others may be included in 64bit offset builds
+  // (e.g. reflection), just without this function.
+  if (!parser.UsesOffset64()) {
+    code += "#ifndef FLATBUFFERS_64BIT_OFFSETS  ";
+    code += "// Laid out for 32bit offsets.\n";
+  }
+  code += "inline flatbuffers::Offset<" + struct_def.name + "> Create";
+  code += struct_def.name + "Direct(flatbuffers::FlatBufferBuilder &_fbb";
+  for (auto it = fields.begin(); it != fields.end(); ++it) {
+    auto &field = **it;
+    if (!field.deprecated) {
+      code += ",\n   " + GenTypeWire(parser, field.value.type, " ", true);
+      code += field.name;
+    }
+  }
+  code += ") {\n";
+  code += "  static const uint8_t _vtable[] = {";
+  for (auto it = vtable_bytes.begin(); it != vtable_bytes.end(); ++it) {
+    code += (it == vtable_bytes.begin() ? " " : ", ") + NumToString(*it);
+  }
+  code += " };\n";
+  code += "  auto _table = _fbb.StartDirectTable(" + NumToString(table_size);
+  code += ", " + NumToString(table_align) + ");\n";
+  for (auto it = order.begin(); it != order.end(); ++it) {
+    auto &field = *fields[*it];
+    code += "  _fbb.AddDirect";
+    if (IsScalar(field.value.type.base_type)) {
+      code += "Element<" + GenTypeWire(parser, field.value.type, "", false);
+      code += ">";
+    } else if (IsStruct(field.value.type)) {
+      code += "Struct";
+    } else {
+      code += "Offset";
+    }
+    code += "(_table, " + NumToString(field_offsets[*it]) + ", ";
+    code += GenUnderlyingCast(field, false, field.name) + ");\n";
+  }
+  code += "  return flatbuffers::Offset<" + struct_def.name + ">(";
+  code += "_fbb.EndDirectTable(_table, _vtable, " + NumToString(hash);
+  code += "U));\n}\n";
+  if (!parser.UsesOffset64()) code += "#endif\n";
+  code += "\n";
+}
+
 // Generate an accessor struct, builder structs & function for a table.
 static void GenTable(const Parser &parser, StructDef &struct_def,
                      std::string *code_ptr) {
@@ -332,16 +556,27 @@ static void GenTable(const Parser &parser, StructDef &struct_def,
         ? "GetField<"
         : (IsStruct(field.value.type) ? "GetStruct<" : "GetPointer<");
       auto offsetstr = GenFieldOffsetName(field);
-      auto call =
+      auto accessor_type =
           accessor +
           GenTypeGet(parser, field.value.type, "", "const ", " *", false) +
-          ">(" + offsetstr;
+          ">(";
+      auto args = offsetstr;
       // Default value as second arg for non-pointer types.
       if (IsScalar(field.value.type.base_type))
-        call += ", " + GenDefaultConstant(field);
-      call += ")";
-      code += GenUnderlyingCast(field, true, call);
+        args += ", " + GenDefaultConstant(field);
+      args += ")";
+      code += GenUnderlyingCast(field, true, accessor_type + args);
       code += "; }\n";
+      if (parser.opts.vtable_cache_accessors) {
+        // The same, decoding the vtable through a flatbuffers::VTableCache.
+        code += "  " + GenTypeGet(parser, field.value.type, " ", "const ",
+                                  " *", true);
+        code += field.name + "(flatbuffers::VTableCache &_cache) const { ";
+        code += "return ";
+        code += GenUnderlyingCast(field, true,
+                                  accessor_type + "_cache, " + args);
+        code += "; }\n";
+      }
       if (parser.opts.mutable_buffer) {
         if (is_scalar) {
           code += "  bool mutate_" + field.name + "(";
@@ -357,6 +592,16 @@ static void GenTable(const Parser &parser, StructDef &struct_def,
           code += "; }\n";
         }
       }
+      if (is_scalar) {
+        // Bulk read of this field over a vector of these tables, see
+        // flatbuffers::GatherField().
+        auto type = GenTypeBasic(field.value.type, false);
+        code += "  static void gather_" + field.name + "(const flatbuffers::";
+        code += "Vector<flatbuffers::Offset<" + struct_def.name + ">> &tables";
+        code += ", " + type + " *out) { flatbuffers::GatherField<" + type;
+        code += ">(tables, " + offsetstr + ", " + GenDefaultConstant(field);
+        code += ", out); }\n";
+      }
       auto nested = field.attributes.Lookup("nested_flatbuffer");
       if (nested) {
         std::string qualified_name =
@@ -370,6 +615,38 @@ static void GenTable(const Parser &parser, StructDef &struct_def,
         code += "_nested_root() const { return flatbuffers::GetRoot<";
         code += cpp_qualified_name + ">(" + field.name + "()->Data()); }\n";
       }
+      // Vectors stored in Eytzinger order can't be searched with
+      // LookupByKey(), so generate a lookup that doesn't need to be told.
+      if (field.attributes.Lookup("key_layout")) {
+        auto &element = *field.value.type.struct_def;
+        const FieldDef *key_field = nullptr;
+        for (auto kit = element.fields.vec.begin();
+             kit != element.fields.vec.end();
+             ++kit) {
+          if ((*kit)->key) key_field = *kit;
+        }
+        assert(key_field);  // Guaranteed by the parser.
+        auto &key_type = key_field->value.type;
+        code += "  const " + WrapInNameSpace(element) + " *" + field.name;
+        code += "_by_key(";
+        if (key_type.base_type == BASE_TYPE_STRING) {
+          code += "const char *";
+        } else if (parser.opts.scoped_enums && key_type.enum_def) {
+          code += GenTypeGet(parser, key_type, " ", "const ", " *", true);
+        } else {
+          code += GenTypeBasic(key_type, false) + " ";
+        }
+        code += "key) const { auto v = " + field.name + "(); return v ? ";
+        code += "v->LookupByKeyEytzinger(key) : nullptr; }\n";
+      }
+      // Look up through the index in the auto-generated _hash_index field.
+      if (field.attributes.Lookup("hash_index")) {
+        code += "  const " + WrapInNameSpace(*field.value.type.struct_def);
+        code += " *" + field.name + "_by_key(const char *key) const { ";
+        code += "auto v = " + field.name + "(); return v ? ";
+        code += "v->LookupByKeyHashed(key, " + field.name + "_hash_index()) ";
+        code += ": nullptr; }\n";
+      }
       // Generate a comparison function for this field if it is a key.
       if (field.key) {
         code += "  bool KeyCompareLessThan(const " + struct_def.name;
@@ -394,6 +671,16 @@ static void GenTable(const Parser &parser, StructDef &struct_def,
           code += " val) const { return " + field.name + "() < val ? -1 : ";
           code += field.name + "() > val; }\n";
         }
+        // And an accessor that gives the key in a form
+        // FlatBufferBuilder::CreateVectorOfSortedTables can sort by.
+        if (field.value.type.base_type == BASE_TYPE_STRING) {
+          code += "  const flatbuffers::String *GetKeyValue() const { return ";
+          code += field.name + "(); }\n";
+        } else {
+          auto type = GenTypeBasic(field.value.type, false);
+          code += "  " + type + " GetKeyValue() const { return static_cast<";
+          code += type + ">(" + field.name + "()); }\n";
+        }
       }
     }
   }
@@ -451,6 +738,9 @@ static void GenTable(const Parser &parser, StructDef &struct_def,
   }
   code += prefix + "verifier.EndTable()";
   code += ";\n  }\n";
+  // Declare the descriptor for iterative verification, defined by
+  // GenTableVerifyDescriptor() once all tables are complete types.
+  code += "  static const flatbuffers::TableVerifyDesc *VerifyDescriptor();\n";
   code += "};\n\n";
 
   // Generate a builder struct, with methods of the form:
@@ -500,53 +790,128 @@ static void GenTable(const Parser &parser, StructDef &struct_def,
       code += ");  // " + field.name + "\n";
     }
   }
-  code += "    return o;\n  }\n};\n\n";
-
-  // Generate a convenient CreateX function that uses the above builder
-  // to create a table in one go.
-  code += "inline flatbuffers::Offset<" + struct_def.name + "> Create";
-  code += struct_def.name;
-  code += "(flatbuffers::FlatBufferBuilder &_fbb";
+  code += "    return o;\n  }\n";
+  // Tables without offset fields can be deduplicated by content.
+  bool is_leaf = true;
+  size_t leaf_alignment = 1;
   for (auto it = struct_def.fields.vec.begin();
        it != struct_def.fields.vec.end();
        ++it) {
-    auto &field = **it;
-    if (!field.deprecated) {
-      code += ",\n   " + GenTypeWire(parser, field.value.type, " ", true);
-      code += field.name + " = ";
-      if (field.value.type.enum_def && IsScalar(field.value.type.base_type)) {
-        auto ev = field.value.type.enum_def->ReverseLookup(
-           static_cast<int>(StringToInt(field.value.constant.c_str())), false);
-        if (ev) {
-          code += WrapInNameSpace(field.value.type.enum_def->defined_namespace,
-                                  GetEnumVal(*field.value.type.enum_def, *ev,
-                                             parser.opts));
+    auto &type = (**it).value.type;
+    if ((**it).deprecated) continue;
+    if (!IsScalar(type.base_type) && !IsStruct(type)) is_leaf = false;
+    else leaf_alignment = std::max(leaf_alignment, InlineAlignment(type));
+  }
+  if (is_leaf) {
+    code += "  flatbuffers::Offset<" + struct_def.name + "> FinishShared() {\n";
+    code += "    return flatbuffers::Offset<" + struct_def.name;
+    code += ">(fbb_.EndSharedTable(start_, ";
+    code += NumToString(struct_def.fields.vec.size()) + "));\n  }\n";
+  }
+  code += "};\n\n";
+
+  // Generate a convenient CreateX function that uses the above builder
+  // to create a table in one go, and for leaf tables a CreateSharedX
+  // function, which returns an identical table created earlier if any.
+  for (int shared = 0; shared <= (is_leaf ? 1 : 0); shared++) {
+    code += "inline flatbuffers::Offset<" + struct_def.name + "> Create";
+    code += (shared ? "Shared" : "") + struct_def.name;
+    code += "(flatbuffers::FlatBufferBuilder &_fbb";
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end();
+         ++it) {
+      auto &field = **it;
+      if (!field.deprecated) {
+        code += ",\n   " + GenTypeWire(parser, field.value.type, " ", true);
+        code += field.name + " = ";
+        if (field.value.type.enum_def && IsScalar(field.value.type.base_type)) {
+          auto &enum_def = *field.value.type.enum_def;
+          auto ev = enum_def.ReverseLookup(
+             static_cast<int>(StringToInt(field.value.constant.c_str())), false);
+          if (ev) {
+            code += WrapInNameSpace(enum_def.defined_namespace,
+                                    GetEnumVal(enum_def, *ev, parser.opts));
+          } else {
+            code += GenUnderlyingCast(field, true, field.value.constant);
+          }
+        } else if (field.value.type.base_type == BASE_TYPE_BOOL) {
+          code += field.value.constant == "0" ? "false" : "true";
         } else {
-          code += GenUnderlyingCast(field, true, field.value.constant);
+          code += GenDefaultConstant(field);
+        }
+      }
+    }
+    code += ") {\n";
+    if (shared) {
+      code += "  _fbb.StartSharedTable(" + NumToString(leaf_alignment);
+      code += ");\n";
+    }
+    code += "  " + struct_def.name + "Builder builder_(_fbb);\n";
+    for (size_t size = struct_def.sortbysize ? sizeof(largest_scalar_t) : 1;
+         size;
+         size /= 2) {
+      for (auto it = struct_def.fields.vec.rbegin();
+           it != struct_def.fields.vec.rend();
+           ++it) {
+        auto &field = **it;
+        if (!field.deprecated &&
+            (!struct_def.sortbysize ||
+             size == SizeOf(field.value.type.base_type))) {
+          code += "  builder_.add_" + field.name + "(" + field.name + ");\n";
         }
-      } else if (field.value.type.base_type == BASE_TYPE_BOOL) {
-        code += field.value.constant == "0" ? "false" : "true";
-      } else {
-        code += GenDefaultConstant(field);
       }
     }
+    code += "  return builder_.";
+    code += shared ? "FinishShared" : "Finish";
+    code += "();\n}\n\n";
   }
-  code += ") {\n  " + struct_def.name + "Builder builder_(_fbb);\n";
-  for (size_t size = struct_def.sortbysize ? sizeof(largest_scalar_t) : 1;
-       size;
-       size /= 2) {
-    for (auto it = struct_def.fields.vec.rbegin();
-         it != struct_def.fields.vec.rend();
-         ++it) {
-      auto &field = **it;
-      if (!field.deprecated &&
-          (!struct_def.sortbysize ||
-           size == SizeOf(field.value.type.base_type))) {
-        code += "  builder_.add_" + field.name + "(" + field.name + ");\n";
+
+  // Generate a function giving an upper bound on the size of the above,
+  // given the lengths of its strings and vectors, for use with
+  // FlatBufferBuilder::Reserve(). The fixed part (the table with worst case
+  // padding, and its vtable) is computed here, except for the offsets in it,
+  // which are counted separately as their size depends on the build.
+  auto fixed_size = (struct_def.fields.vec.size() + 2) * sizeof(voffset_t);
+  size_t num_offsets = 1;  // The vtable offset.
+  std::string params, bounds;
+  for (auto it = struct_def.fields.vec.begin();
+       it != struct_def.fields.vec.end();
+       ++it) {
+    auto &field = **it;
+    if (field.deprecated) continue;
+    if (IsScalar(field.value.type.base_type) || IsStruct(field.value.type)) {
+      fixed_size += InlineSize(field.value.type) +
+                    InlineAlignment(field.value.type) - 1;
+    } else {
+      num_offsets++;
+    }
+    auto param = field.name + "_len";
+    if (field.value.type.base_type == BASE_TYPE_STRING) {
+      bounds += " +\n    flatbuffers::StringSizeBound(" + param + ")";
+    } else if (field.value.type.base_type == BASE_TYPE_VECTOR) {
+      auto vector_type = field.value.type.VectorType();
+      bounds += " +\n    flatbuffers::VectorSizeBound(" + param + ", ";
+      if (IsScalar(vector_type.base_type) || IsStruct(vector_type)) {
+        bounds += NumToString(InlineSize(vector_type)) + ", ";
+        bounds += NumToString(InlineAlignment(vector_type)) + ")";
+      } else {
+        bounds += "sizeof(flatbuffers::uoffset_t), ";
+        bounds += "sizeof(flatbuffers::uoffset_t))";
       }
+    } else {
+      continue;
     }
+    if (!params.empty()) params += ",\n   ";
+    params += "size_t " + param + " = 0";
   }
-  code += "  return builder_.Finish();\n}\n\n";
+  // Each offset takes its size plus at most its size - 1 of padding.
+  fixed_size -= num_offsets;
+  code += "inline size_t " + struct_def.name + "SizeBound(" + params;
+  code += ") {\n  return " + NumToString(fixed_size) + " + ";
+  code += NumToString(num_offsets * 2) + " * sizeof(flatbuffers::uoffset_t)";
+  code += bounds + ";\n}\n\n";
+
+  GenDirectCreate(parser, struct_def, code_ptr);
 }
 
 static void GenPadding(const FieldDef &field, std::string &code,
@@ -576,6 +941,115 @@ static void PaddingInitializer(int bits, std::string &code, int &padding_id) {
   code += ", __padding" + NumToString(padding_id++) + "(0)";
 }
 
+// Return the C++ type of the view on a table field in a CheckedTable.
+static std::string GenCheckedType(const StructDef &struct_def) {
+  return WrapInNameSpace(struct_def.defined_namespace,
+                         "Checked" + struct_def.name);
+}
+
+// Generate a view on a table that checks everything it reads (for
+// --gen-checked), with the same accessors as the table itself, except that
+// tables come back as views rather than pointers.
+static void GenCheckedTable(const Parser &parser, const StructDef &struct_def,
+                            std::string *code_ptr) {
+  std::string &code = *code_ptr;
+  auto name = "Checked" + struct_def.name;
+  code += "struct " + name;
+  code += " FLATBUFFERS_FINAL_CLASS : private flatbuffers::CheckedTable {\n";
+  code += "  " + name + "() {}\n";
+  code += "  explicit " + name + "(const flatbuffers::CheckedTable &table)\n";
+  code += "    : flatbuffers::CheckedTable(table) {}\n";
+  code += "  using flatbuffers::CheckedTable::IsNull;\n";
+  for (auto it = struct_def.fields.vec.begin();
+       it != struct_def.fields.vec.end();
+       ++it) {
+    auto &field = **it;
+    if (field.deprecated) continue;
+    auto &type = field.value.type;
+    auto offsetstr = struct_def.name + "::" + GenFieldOffsetName(field);
+    if (IsScalar(type.base_type)) {
+      code += "  " + GenTypeBasic(type, true) + " " + field.name;
+      code += "() const { return ";
+      code += GenUnderlyingCast(field, true,
+                                "GetField<" + GenTypeBasic(type, false) +
+                                ">(" + offsetstr + ", " +
+                                GenDefaultConstant(field) + ")");
+      code += "; }\n";
+      continue;
+    }
+    switch (type.base_type) {
+      case BASE_TYPE_STRUCT:
+        if (type.struct_def->fixed) {
+          code += "  const " + GenTypePointer(parser, type) + " *";
+          code += field.name + "() const { return GetStruct<";
+          code += GenTypePointer(parser, type) + ">(" + offsetstr + "); }\n";
+        } else {
+          // Defined by GenCheckedTablePost(), once all views are complete.
+          code += "  " + GenCheckedType(*type.struct_def) + " " + field.name;
+          code += "() const;\n";
+        }
+        break;
+      case BASE_TYPE_UNION:
+        code += "  flatbuffers::CheckedTable " + field.name;
+        code += "() const { return GetTable(" + offsetstr + "); }\n";
+        break;
+      case BASE_TYPE_STRING:
+        code += "  const flatbuffers::String *" + field.name;
+        code += "() const { return GetString(" + offsetstr + "); }\n";
+        break;
+      case BASE_TYPE_VECTOR:
+        if (type.element == BASE_TYPE_STRING) {
+          code += "  flatbuffers::CheckedVectorOfStrings " + field.name;
+          code += "() const { return GetVectorOfStrings(" + offsetstr;
+          code += "); }\n";
+        } else if (type.element == BASE_TYPE_STRUCT &&
+                   !type.struct_def->fixed) {
+          code += "  flatbuffers::CheckedVectorOfTables<";
+          code += GenCheckedType(*type.struct_def) + "> " + field.name;
+          code += "() const;\n";
+        } else {
+          auto vector_type = GenTypePointer(parser, type);
+          code += "  const " + vector_type + " *" + field.name;
+          code += "() const { return GetVector<" + vector_type + ">(";
+          code += offsetstr + ", sizeof(" +
+                  GenTypeSize(parser, type.VectorType()) + ")); }\n";
+        }
+        break;
+      default:
+        break;
+    }
+  }
+  code += "};\n\n";
+}
+
+// Generate the accessors of a checked view that return other views.
+static void GenCheckedTablePost(const StructDef &struct_def,
+                                std::string *code_ptr) {
+  std::string &code = *code_ptr;
+  auto name = "Checked" + struct_def.name;
+  for (auto it = struct_def.fields.vec.begin();
+       it != struct_def.fields.vec.end();
+       ++it) {
+    auto &field = **it;
+    if (field.deprecated) continue;
+    auto &type = field.value.type;
+    auto offsetstr = struct_def.name + "::" + GenFieldOffsetName(field);
+    if (type.base_type == BASE_TYPE_STRUCT && !type.struct_def->fixed) {
+      auto view = GenCheckedType(*type.struct_def);
+      code += "inline " + view + " " + name + "::" + field.name;
+      code += "() const {\n  return " + view + "(GetTable(" + offsetstr;
+      code += "));\n}\n\n";
+    } else if (type.base_type == BASE_TYPE_VECTOR &&
+               type.element == BASE_TYPE_STRUCT && !type.struct_def->fixed) {
+      auto view = GenCheckedType(*type.struct_def);
+      code += "inline flatbuffers::CheckedVectorOfTables<" + view + "> ";
+      code += name + "::" + field.name + "() const {\n";
+      code += "  return GetVectorOfTables<" + view + ">(" + offsetstr;
+      code += ");\n}\n\n";
+    }
+  }
+}
+
 // Generate an accessor struct with constructor for a flatbuffers struct.
 static void GenStruct(const Parser &parser, StructDef &struct_def,
                       std::string *code_ptr) {
@@ -774,6 +1248,12 @@ class CppGenerator : public BaseGenerator {
 
     code += "#include \"flatbuffers/flatbuffers.h\"\n\n";
 
+    if (parser_.UsesOffset64()) {
+      code += "static_assert(sizeof(flatbuffers::uoffset_t) == 8,\n";
+      code += "              \"" + file_name_ + ".fbs uses 64bit offsets, ";
+      code += "define FLATBUFFERS_64BIT_OFFSETS\");\n\n";
+    }
+
     if (parser_.opts.include_dependence_headers) {
       int num_includes = 0;
       for (auto it = parser_.included_files_.begin();
@@ -839,6 +1319,36 @@ class CppGenerator : public BaseGenerator {
       }
     }
 
+    // Generate the iterative verification descriptors of all tables.
+    for (auto it = parser_.structs_.vec.begin(); it != parser_.structs_.vec.end();
+         ++it) {
+      auto &struct_def = **it;
+      if (!struct_def.fixed && !struct_def.generated) {
+        CheckNameSpace(struct_def, &code);
+        GenTableVerifyDescriptor(parser_, struct_def, &code);
+      }
+    }
+
+    // Generate views that check buffers as they're read.
+    if (parser_.opts.checked_accessors) {
+      for (auto it = parser_.structs_.vec.begin();
+           it != parser_.structs_.vec.end(); ++it) {
+        auto &struct_def = **it;
+        if (!struct_def.fixed && !struct_def.generated) {
+          CheckNameSpace(struct_def, &code);
+          GenCheckedTable(parser_, struct_def, &code);
+        }
+      }
+      for (auto it = parser_.structs_.vec.begin();
+           it != parser_.structs_.vec.end(); ++it) {
+        auto &struct_def = **it;
+        if (!struct_def.fixed && !struct_def.generated) {
+          CheckNameSpace(struct_def, &code);
+          GenCheckedTablePost(struct_def, &code);
+        }
+      }
+    }
+
     // Generate convenient global helper functions:
     if (parser_.root_struct_def_) {
       CheckNameSpace(*parser_.root_struct_def_, &code);
@@ -852,6 +1362,15 @@ class CppGenerator : public BaseGenerator {
       code += name;
       code += "(const void *buf) { return flatbuffers::GetRoot<";
       code += cpp_qualified_name + ">(buf); }\n\n";
+      code += "inline const " + cpp_qualified_name + " *GetSizePrefixed";
+      code += name;
+      code += "(const void *buf) { return flatbuffers::GetSizePrefixedRoot<";
+      code += cpp_qualified_name + ">(buf); }\n\n";
+      if (parser_.opts.checked_accessors) {
+        code += "inline Checked" + name + " GetChecked" + name;
+        code += "(const flatbuffers::CheckedBuffer &buf) { return Checked";
+        code += name + "(buf.GetRootTable()); }\n\n";
+      }
       if (parser_.opts.mutable_buffer) {
         code += "inline " + name + " *GetMutable";
         code += name;
@@ -866,6 +1385,12 @@ class CppGenerator : public BaseGenerator {
           "Buffer(flatbuffers::Verifier &verifier) { "
           "return verifier.VerifyBuffer<";
       code += cpp_qualified_name + ">(); }\n\n";
+      code += "inline bool VerifySizePrefixed";
+      code += name;
+      code +=
+          "Buffer(flatbuffers::Verifier &verifier) { "
+          "return verifier.VerifySizePrefixedBuffer<";
+      code += cpp_qualified_name + ">(); }\n\n";
 
       if (parser_.file_identifier_.length()) {
         // Return the identifier
@@ -895,6 +1420,13 @@ class CppGenerator : public BaseGenerator {
       if (parser_.file_identifier_.length())
         code += ", " + name + "Identifier()";
       code += "); }\n\n";
+      code += "inline void FinishSizePrefixed" + name;
+      code +=
+          "Buffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<";
+      code += cpp_qualified_name + "> root) { fbb.FinishSizePrefixed(root";
+      if (parser_.file_identifier_.length())
+        code += ", " + name + "Identifier()";
+      code += "); }\n\n";
     }
 
     assert(code_generator_cur_name_space);
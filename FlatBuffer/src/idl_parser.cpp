@@ -616,6 +616,35 @@ CheckedError Parser::ParseField(StructDef &struct_def) {
     // wasn't defined elsewhere.
     LookupCreateStruct(nested->constant);
   }
+  auto key_layout = field->attributes.Lookup("key_layout");
+  if (key_layout) {
+    if (key_layout->type.base_type != BASE_TYPE_STRING ||
+        key_layout->constant != "eytzinger")
+      return Error("key_layout attribute must be \"eytzinger\"");
+    // Whether the elements are tables with a key is checked once all types
+    // are known.
+    if (field->value.type.base_type != BASE_TYPE_VECTOR ||
+        field->value.type.element != BASE_TYPE_STRUCT)
+      return Error("key_layout attribute may only apply to a vector of tables");
+  }
+  FieldDef *indexfield = nullptr;
+  if (field->attributes.Lookup("hash_index")) {
+    if (field->value.type.base_type != BASE_TYPE_VECTOR ||
+        field->value.type.element != BASE_TYPE_STRUCT)
+      return Error("hash_index attribute may only apply to a vector of tables");
+    if (key_layout)
+      return Error("hash_index and key_layout attributes can't be combined");
+    // Without ids, the field below would shift the ids of all fields after
+    // it, breaking compatibility with buffers written without the index.
+    if (!field->attributes.Lookup("id"))
+      return Error("hash_index attribute needs an id on the field");
+    // The index is stored in a second auto-generated field, with _hash_index
+    // appended as the name.
+    Type index_type(BASE_TYPE_VECTOR);
+    index_type.element = BASE_TYPE_UINT;
+    ECHECK(AddField(struct_def, name + "_hash_index", index_type,
+                    &indexfield));
+  }
 
   if (typefield) {
     // If this field is a union, and it has a manually assigned id,
@@ -629,6 +658,15 @@ CheckedError Parser::ParseField(StructDef &struct_def) {
       typefield->attributes.Add("id", val);
     }
   }
+  if (indexfield) {
+    // Likewise, a hash index follows its vector, with an id of N + 1.
+    auto attr = field->attributes.Lookup("id");
+    auto id = atoi(attr->constant.c_str());
+    auto val = new Value();
+    val->type = attr->type;
+    val->constant = NumToString(id + 1);
+    indexfield->attributes.Add("id", val);
+  }
 
   EXPECT(';');
   return NoError();
@@ -1750,6 +1788,13 @@ CheckedError Parser::DoParse(const char *source, const char **include_paths,
       if (builder_.GetSize()) {
         return Error("cannot have more than one json object in a file");
       }
+      if (UsesOffset64() != (sizeof(uoffset_t) == 8)) {
+        return Error(UsesOffset64()
+          ? "schema uses 64bit offsets, this requires a build with "
+            "FLATBUFFERS_64BIT_OFFSETS"
+          : "schema uses 32bit offsets, this requires a build without "
+            "FLATBUFFERS_64BIT_OFFSETS");
+      }
       uoffset_t toff;
       ECHECK(ParseTable(*root_struct_def_, nullptr, &toff));
       builder_.Finish(Offset<Table>(toff),
@@ -1802,6 +1847,29 @@ CheckedError Parser::DoParse(const char *source, const char **include_paths,
       return Error("type referenced but not defined: " + (*it)->name);
     }
   }
+  for (auto it = structs_.vec.begin(); it != structs_.vec.end(); ++it) {
+    auto &fields = (*it)->fields.vec;
+    for (auto field = fields.begin(); field != fields.end(); ++field) {
+      auto element = (*field)->value.type.struct_def;
+      if ((*field)->attributes.Lookup("key_layout") &&
+          (element->fixed || !element->has_key))
+        return Error("key_layout attribute needs a table with a key field: " +
+                     (*field)->name);
+      if ((*field)->attributes.Lookup("hash_index")) {
+        auto string_key = false;
+        for (auto key = element->fields.vec.begin();
+             key != element->fields.vec.end();
+             ++key) {
+          if ((*key)->key &&
+              (*key)->value.type.base_type == BASE_TYPE_STRING)
+            string_key = true;
+        }
+        if (element->fixed || !string_key)
+          return Error("hash_index attribute needs a table with a string key "
+                       "field: " + (*field)->name);
+      }
+    }
+  }
   for (auto it = enums_.vec.begin(); it != enums_.vec.end(); ++it) {
     auto &enum_def = **it;
     if (enum_def.is_union) {
@@ -476,4 +476,146 @@ Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
   }
 }
 
+SchemaVerifier::SchemaVerifier(const reflection::Schema &schema)
+    : schema_(schema) {
+  auto objects = schema.objects();
+  // Descriptors point into fields_ and links_, so size those first.
+  size_t num_fields = 0, num_links = 0;
+  for (uoffset_t i = 0; i < objects->size(); i++) {
+    auto &obj = *objects->Get(i);
+    if (obj.is_struct()) continue;
+    for (uoffset_t j = 0; j < obj.fields()->size(); j++) {
+      auto &fielddef = *obj.fields()->Get(j);
+      if (fielddef.deprecated()) continue;
+      num_fields++;
+      auto type = fielddef.type();
+      if (type->base_type() == reflection::Union) {
+        auto values = schema.enums()->Get(type->index())->values();
+        num_links += static_cast<size_t>(
+          values->Get(values->size() - 1)->value() + 1);
+      } else if (type->base_type() == reflection::Obj ||
+                 (type->base_type() == reflection::Vector &&
+                  type->element() == reflection::Obj)) {
+        num_links++;
+      }
+    }
+  }
+  tables_.resize(objects->size());
+  fields_.reserve(num_fields);
+  links_.reserve(num_links);
+
+  for (uoffset_t i = 0; i < objects->size(); i++) {
+    auto &obj = *objects->Get(i);
+    if (obj.is_struct()) continue;
+    auto first_field = fields_.size();
+    for (uoffset_t j = 0; j < obj.fields()->size(); j++) {
+      auto &fielddef = *obj.fields()->Get(j);
+      if (fielddef.deprecated()) continue;
+      auto type = fielddef.type();
+      FieldVerifyDesc field = { fielddef.offset(), fielddef.name()->c_str(),
+                                FieldVerifyDesc::kScalar, fielddef.required(),
+                                0, nullptr, 0, nullptr, 0, nullptr };
+      switch (type->base_type()) {
+        case reflection::String:
+          field.kind = FieldVerifyDesc::kString;
+          break;
+        case reflection::Obj: {
+          auto &child = *objects->Get(type->index());
+          if (child.is_struct()) {
+            field.kind = FieldVerifyDesc::kStruct;
+            field.size = static_cast<size_t>(child.bytesize());
+          } else {
+            field.kind = FieldVerifyDesc::kTable;
+            field.descs = links_.data() + links_.size();
+            links_.push_back(&tables_[type->index()]);
+          }
+          break;
+        }
+        case reflection::Vector:
+          if (type->element() == reflection::String) {
+            field.kind = FieldVerifyDesc::kVectorOfStrings;
+          } else if (type->element() == reflection::Obj &&
+                     !objects->Get(type->index())->is_struct()) {
+            field.kind = FieldVerifyDesc::kVectorOfTables;
+            field.descs = links_.data() + links_.size();
+            links_.push_back(&tables_[type->index()]);
+          } else {
+            field.kind = FieldVerifyDesc::kVector;
+            field.size = GetTypeSizeInline(type->element(), type->index(),
+                                           schema);
+          }
+          break;
+        case reflection::Union: {
+          auto type_field = obj.fields()->LookupByKey(
+            (fielddef.name()->str() + "_type").c_str());
+          assert(type_field);
+          if (!type_field) continue;
+          auto values = schema.enums()->Get(type->index())->values();
+          field.kind = FieldVerifyDesc::kUnion;
+          field.union_type_field = type_field->offset();
+          field.num_union_tables = static_cast<size_t>(
+            values->Get(values->size() - 1)->value() + 1);
+          auto first_link = links_.size();
+          links_.resize(first_link + field.num_union_tables, nullptr);
+          field.descs = links_.data() + first_link;
+          for (uoffset_t k = 0; k < values->size(); k++) {
+            auto &enumval = *values->Get(k);
+            if (!enumval.value() || !enumval.object()) continue;  // NONE.
+            auto index = ObjectIndex(enumval.object()->name()->c_str());
+            assert(index < objects->size());
+            links_[first_link + static_cast<size_t>(enumval.value())] =
+              &tables_[index];
+          }
+          break;
+        }
+        default:
+          field.size = GetTypeSize(type->base_type());
+          break;
+      }
+      fields_.push_back(field);
+    }
+    tables_[i].num_fields = fields_.size() - first_field;
+    tables_[i].fields = tables_[i].num_fields ? fields_.data() + first_field
+                                              : nullptr;
+  }
+}
+
+bool SchemaVerifier::VerifyBuffer(const reflection::Object &root,
+                                  const uint8_t *buf, size_t length,
+                                  size_t max_depth, size_t max_tables) const {
+  auto desc = GetDescriptor(root);
+  if (!desc) return false;
+  Verifier verifier(buf, length, max_depth, max_tables);
+  return verifier.Verify<uoffset_t>(buf) &&
+         verifier.VerifyTableIteratively(buf + ReadScalar<uoffset_t>(buf),
+                                         desc);
+}
+
+const TableVerifyDesc *SchemaVerifier::GetDescriptor(
+    const reflection::Object &obj) const {
+  auto index = ObjectIndex(obj.name()->c_str());
+  return index < tables_.size() && !obj.is_struct() ? &tables_[index]
+                                                    : nullptr;
+}
+
+uoffset_t SchemaVerifier::ObjectIndex(const char *name) const {
+  // Objects are sorted by name.
+  auto objects = schema_.objects();
+  uoffset_t lo = 0, hi = objects->size();
+  while (lo < hi) {
+    auto mid = lo + (hi - lo) / 2;
+    auto comp = strcmp(objects->Get(mid)->name()->c_str(), name);
+    if (!comp) return mid;
+    if (comp < 0) lo = mid + 1; else hi = mid;
+  }
+  return objects->size();
+}
+
+bool VerifyBuffer(const reflection::Schema &schema,
+                  const reflection::Object &root, const uint8_t *buf,
+                  size_t length, size_t max_depth, size_t max_tables) {
+  return SchemaVerifier(schema).VerifyBuffer(root, buf, length, max_depth,
+                                             max_tables);
+}
+
 }  // namespace flatbuffers
@@ -12,6 +12,8 @@
 :: See the License for the specific language governing permissions and
 :: limitations under the License.
 
-..\flatc.exe --cpp --java --csharp --go --binary --python --js --php --gen-mutable --no-includes monster_test.fbs monsterdata_test.json
+..\flatc.exe --cpp --java --csharp --go --binary --python --js --php --gen-mutable --gen-checked --no-includes monster_test.fbs monsterdata_test.json
 ..\flatc.exe --cpp --java --csharp --go --binary --python --js --php --gen-mutable -o namespace_test namespace_test\namespace_test1.fbs namespace_test\namespace_test2.fbs
+..\flatc.exe --cpp --scoped-enums --gen-vtable-cache --gen-mutable --gen-checked --no-includes key_lookup_test.fbs
+..\flatc.exe --cpp --gen-mutable --gen-checked --no-includes offset64_test.fbs
 ..\flatc.exe --binary --schema monster_test.fbs
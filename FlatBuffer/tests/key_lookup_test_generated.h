@@ -0,0 +1,445 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+#ifndef FLATBUFFERS_GENERATED_KEYLOOKUPTEST_MYGAME_KEYLOOKUP_H_
+#define FLATBUFFERS_GENERATED_KEYLOOKUPTEST_MYGAME_KEYLOOKUP_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+namespace MyGame {
+namespace KeyLookup {
+
+struct Named;
+
+struct Numbered;
+
+struct Typed;
+
+struct Catalog;
+
+enum class Element : uint8_t {
+  Fire = 0,
+  Water = 1,
+  Earth = 2,
+  Air = 3,
+  MIN = Fire,
+  MAX = Air
+};
+
+inline const char **EnumNamesElement() {
+  static const char *names[] = { "Fire", "Water", "Earth", "Air", nullptr };
+  return names;
+}
+
+inline const char *EnumNameElement(Element e) { return EnumNamesElement()[static_cast<int>(e)]; }
+
+struct Named FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_NAME = 4
+  };
+  const flatbuffers::String *name() const { return GetPointer<const flatbuffers::String *>(VT_NAME); }
+  const flatbuffers::String *name(flatbuffers::VTableCache &_cache) const { return GetPointer<const flatbuffers::String *>(_cache, VT_NAME); }
+  flatbuffers::String *mutable_name() { return GetPointer<flatbuffers::String *>(VT_NAME); }
+  bool KeyCompareLessThan(const Named *o) const { return *name() < *o->name(); }
+  int KeyCompareWithValue(const char *val) const { return strcmp(name()->c_str(), val); }
+  const flatbuffers::String *GetKeyValue() const { return name(); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyFieldRequired<flatbuffers::uoffset_t>(verifier, VT_NAME) &&
+           verifier.Verify(name()) &&
+           verifier.EndTable();
+  }
+  static const flatbuffers::TableVerifyDesc *VerifyDescriptor();
+};
+
+struct NamedBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) { fbb_.AddOffset(Named::VT_NAME, name); }
+  NamedBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  NamedBuilder &operator=(const NamedBuilder &);
+  flatbuffers::Offset<Named> Finish() {
+    auto o = flatbuffers::Offset<Named>(fbb_.EndTable(start_, 1));
+    fbb_.Required(o, Named::VT_NAME);  // name
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Named> CreateNamed(flatbuffers::FlatBufferBuilder &_fbb,
+   flatbuffers::Offset<flatbuffers::String> name = 0) {
+  NamedBuilder builder_(_fbb);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+inline size_t NamedSizeBound(size_t name_len = 0) {
+  return 4 + 4 * sizeof(flatbuffers::uoffset_t) +
+    flatbuffers::StringSizeBound(name_len);
+}
+
+#ifndef FLATBUFFERS_64BIT_OFFSETS  // Laid out for 32bit offsets.
+inline flatbuffers::Offset<Named> CreateNamedDirect(flatbuffers::FlatBufferBuilder &_fbb,
+   flatbuffers::Offset<flatbuffers::String> name) {
+  static const uint8_t _vtable[] = { 6, 0, 8, 0, 4, 0 };
+  auto _table = _fbb.StartDirectTable(8, 4);
+  _fbb.AddDirectOffset(_table, 4, name);
+  return flatbuffers::Offset<Named>(_fbb.EndDirectTable(_table, _vtable, 2641594567U));
+}
+#endif
+
+struct Numbered FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_NUMBER = 4
+  };
+  int32_t number() const { return GetField<int32_t>(VT_NUMBER, 0); }
+  int32_t number(flatbuffers::VTableCache &_cache) const { return GetField<int32_t>(_cache, VT_NUMBER, 0); }
+  bool mutate_number(int32_t _number) { return SetField(VT_NUMBER, _number); }
+  static void gather_number(const flatbuffers::Vector<flatbuffers::Offset<Numbered>> &tables, int32_t *out) { flatbuffers::GatherField<int32_t>(tables, VT_NUMBER, 0, out); }
+  bool KeyCompareLessThan(const Numbered *o) const { return number() < o->number(); }
+  int KeyCompareWithValue(int32_t val) const { return number() < val ? -1 : number() > val; }
+  int32_t GetKeyValue() const { return static_cast<int32_t>(number()); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int32_t>(verifier, VT_NUMBER) &&
+           verifier.EndTable();
+  }
+  static const flatbuffers::TableVerifyDesc *VerifyDescriptor();
+};
+
+struct NumberedBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_number(int32_t number) { fbb_.AddElement<int32_t>(Numbered::VT_NUMBER, number, 0); }
+  NumberedBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  NumberedBuilder &operator=(const NumberedBuilder &);
+  flatbuffers::Offset<Numbered> Finish() {
+    auto o = flatbuffers::Offset<Numbered>(fbb_.EndTable(start_, 1));
+    return o;
+  }
+  flatbuffers::Offset<Numbered> FinishShared() {
+    return flatbuffers::Offset<Numbered>(fbb_.EndSharedTable(start_, 1));
+  }
+};
+
+inline flatbuffers::Offset<Numbered> CreateNumbered(flatbuffers::FlatBufferBuilder &_fbb,
+   int32_t number = 0) {
+  NumberedBuilder builder_(_fbb);
+  builder_.add_number(number);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Numbered> CreateSharedNumbered(flatbuffers::FlatBufferBuilder &_fbb,
+   int32_t number = 0) {
+  _fbb.StartSharedTable(4);
+  NumberedBuilder builder_(_fbb);
+  builder_.add_number(number);
+  return builder_.FinishShared();
+}
+
+inline size_t NumberedSizeBound() {
+  return 12 + 2 * sizeof(flatbuffers::uoffset_t);
+}
+
+#ifndef FLATBUFFERS_64BIT_OFFSETS  // Laid out for 32bit offsets.
+inline flatbuffers::Offset<Numbered> CreateNumberedDirect(flatbuffers::FlatBufferBuilder &_fbb,
+   int32_t number) {
+  static const uint8_t _vtable[] = { 6, 0, 8, 0, 4, 0 };
+  auto _table = _fbb.StartDirectTable(8, 4);
+  _fbb.AddDirectElement<int32_t>(_table, 4, number);
+  return flatbuffers::Offset<Numbered>(_fbb.EndDirectTable(_table, _vtable, 2641594567U));
+}
+#endif
+
+struct Typed FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_ELEMENT = 4
+  };
+  Element element() const { return static_cast<Element>(GetField<uint8_t>(VT_ELEMENT, 0)); }
+  Element element(flatbuffers::VTableCache &_cache) const { return static_cast<Element>(GetField<uint8_t>(_cache, VT_ELEMENT, 0)); }
+  bool mutate_element(Element _element) { return SetField(VT_ELEMENT, static_cast<uint8_t>(_element)); }
+  static void gather_element(const flatbuffers::Vector<flatbuffers::Offset<Typed>> &tables, uint8_t *out) { flatbuffers::GatherField<uint8_t>(tables, VT_ELEMENT, 0, out); }
+  bool KeyCompareLessThan(const Typed *o) const { return element() < o->element(); }
+  int KeyCompareWithValue(Element  val) const { return element() < val ? -1 : element() > val; }
+  uint8_t GetKeyValue() const { return static_cast<uint8_t>(element()); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint8_t>(verifier, VT_ELEMENT) &&
+           verifier.EndTable();
+  }
+  static const flatbuffers::TableVerifyDesc *VerifyDescriptor();
+};
+
+struct TypedBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_element(Element element) { fbb_.AddElement<uint8_t>(Typed::VT_ELEMENT, static_cast<uint8_t>(element), 0); }
+  TypedBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  TypedBuilder &operator=(const TypedBuilder &);
+  flatbuffers::Offset<Typed> Finish() {
+    auto o = flatbuffers::Offset<Typed>(fbb_.EndTable(start_, 1));
+    return o;
+  }
+  flatbuffers::Offset<Typed> FinishShared() {
+    return flatbuffers::Offset<Typed>(fbb_.EndSharedTable(start_, 1));
+  }
+};
+
+inline flatbuffers::Offset<Typed> CreateTyped(flatbuffers::FlatBufferBuilder &_fbb,
+   Element element = Element::Fire) {
+  TypedBuilder builder_(_fbb);
+  builder_.add_element(element);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Typed> CreateSharedTyped(flatbuffers::FlatBufferBuilder &_fbb,
+   Element element = Element::Fire) {
+  _fbb.StartSharedTable(1);
+  TypedBuilder builder_(_fbb);
+  builder_.add_element(element);
+  return builder_.FinishShared();
+}
+
+inline size_t TypedSizeBound() {
+  return 6 + 2 * sizeof(flatbuffers::uoffset_t);
+}
+
+#ifndef FLATBUFFERS_64BIT_OFFSETS  // Laid out for 32bit offsets.
+inline flatbuffers::Offset<Typed> CreateTypedDirect(flatbuffers::FlatBufferBuilder &_fbb,
+   Element element) {
+  static const uint8_t _vtable[] = { 6, 0, 8, 0, 4, 0 };
+  auto _table = _fbb.StartDirectTable(8, 4);
+  _fbb.AddDirectElement<uint8_t>(_table, 4, static_cast<uint8_t>(element));
+  return flatbuffers::Offset<Typed>(_fbb.EndDirectTable(_table, _vtable, 2641594567U));
+}
+#endif
+
+struct Catalog FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_HASHED = 4,
+    VT_HASHED_HASH_INDEX = 6,
+    VT_NAMED = 8,
+    VT_NUMBERED = 10,
+    VT_TYPED = 12,
+    VT_COUNT = 14
+  };
+  const flatbuffers::Vector<flatbuffers::Offset<Named>> *hashed() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Named>> *>(VT_HASHED); }
+  const flatbuffers::Vector<flatbuffers::Offset<Named>> *hashed(flatbuffers::VTableCache &_cache) const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Named>> *>(_cache, VT_HASHED); }
+  flatbuffers::Vector<flatbuffers::Offset<Named>> *mutable_hashed() { return GetPointer<flatbuffers::Vector<flatbuffers::Offset<Named>> *>(VT_HASHED); }
+  const Named *hashed_by_key(const char *key) const { auto v = hashed(); return v ? v->LookupByKeyHashed(key, hashed_hash_index()) : nullptr; }
+  const flatbuffers::Vector<uint32_t> *hashed_hash_index() const { return GetPointer<const flatbuffers::Vector<uint32_t> *>(VT_HASHED_HASH_INDEX); }
+  const flatbuffers::Vector<uint32_t> *hashed_hash_index(flatbuffers::VTableCache &_cache) const { return GetPointer<const flatbuffers::Vector<uint32_t> *>(_cache, VT_HASHED_HASH_INDEX); }
+  flatbuffers::Vector<uint32_t> *mutable_hashed_hash_index() { return GetPointer<flatbuffers::Vector<uint32_t> *>(VT_HASHED_HASH_INDEX); }
+  const flatbuffers::Vector<flatbuffers::Offset<Named>> *named() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Named>> *>(VT_NAMED); }
+  const flatbuffers::Vector<flatbuffers::Offset<Named>> *named(flatbuffers::VTableCache &_cache) const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Named>> *>(_cache, VT_NAMED); }
+  flatbuffers::Vector<flatbuffers::Offset<Named>> *mutable_named() { return GetPointer<flatbuffers::Vector<flatbuffers::Offset<Named>> *>(VT_NAMED); }
+  const Named *named_by_key(const char *key) const { auto v = named(); return v ? v->LookupByKeyEytzinger(key) : nullptr; }
+  const flatbuffers::Vector<flatbuffers::Offset<Numbered>> *numbered() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Numbered>> *>(VT_NUMBERED); }
+  const flatbuffers::Vector<flatbuffers::Offset<Numbered>> *numbered(flatbuffers::VTableCache &_cache) const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Numbered>> *>(_cache, VT_NUMBERED); }
+  flatbuffers::Vector<flatbuffers::Offset<Numbered>> *mutable_numbered() { return GetPointer<flatbuffers::Vector<flatbuffers::Offset<Numbered>> *>(VT_NUMBERED); }
+  const Numbered *numbered_by_key(int32_t key) const { auto v = numbered(); return v ? v->LookupByKeyEytzinger(key) : nullptr; }
+  const flatbuffers::Vector<flatbuffers::Offset<Typed>> *typed() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Typed>> *>(VT_TYPED); }
+  const flatbuffers::Vector<flatbuffers::Offset<Typed>> *typed(flatbuffers::VTableCache &_cache) const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Typed>> *>(_cache, VT_TYPED); }
+  flatbuffers::Vector<flatbuffers::Offset<Typed>> *mutable_typed() { return GetPointer<flatbuffers::Vector<flatbuffers::Offset<Typed>> *>(VT_TYPED); }
+  const Typed *typed_by_key(Element key) const { auto v = typed(); return v ? v->LookupByKeyEytzinger(key) : nullptr; }
+  int32_t count() const { return GetField<int32_t>(VT_COUNT, 0); }
+  int32_t count(flatbuffers::VTableCache &_cache) const { return GetField<int32_t>(_cache, VT_COUNT, 0); }
+  bool mutate_count(int32_t _count) { return SetField(VT_COUNT, _count); }
+  static void gather_count(const flatbuffers::Vector<flatbuffers::Offset<Catalog>> &tables, int32_t *out) { flatbuffers::GatherField<int32_t>(tables, VT_COUNT, 0, out); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_HASHED) &&
+           verifier.Verify(hashed()) &&
+           verifier.VerifyVectorOfTables(hashed()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_HASHED_HASH_INDEX) &&
+           verifier.Verify(hashed_hash_index()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_NAMED) &&
+           verifier.Verify(named()) &&
+           verifier.VerifyVectorOfTables(named()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_NUMBERED) &&
+           verifier.Verify(numbered()) &&
+           verifier.VerifyVectorOfTables(numbered()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_TYPED) &&
+           verifier.Verify(typed()) &&
+           verifier.VerifyVectorOfTables(typed()) &&
+           VerifyField<int32_t>(verifier, VT_COUNT) &&
+           verifier.EndTable();
+  }
+  static const flatbuffers::TableVerifyDesc *VerifyDescriptor();
+};
+
+struct CatalogBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_hashed(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Named>>> hashed) { fbb_.AddOffset(Catalog::VT_HASHED, hashed); }
+  void add_hashed_hash_index(flatbuffers::Offset<flatbuffers::Vector<uint32_t>> hashed_hash_index) { fbb_.AddOffset(Catalog::VT_HASHED_HASH_INDEX, hashed_hash_index); }
+  void add_named(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Named>>> named) { fbb_.AddOffset(Catalog::VT_NAMED, named); }
+  void add_numbered(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Numbered>>> numbered) { fbb_.AddOffset(Catalog::VT_NUMBERED, numbered); }
+  void add_typed(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Typed>>> typed) { fbb_.AddOffset(Catalog::VT_TYPED, typed); }
+  void add_count(int32_t count) { fbb_.AddElement<int32_t>(Catalog::VT_COUNT, count, 0); }
+  CatalogBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  CatalogBuilder &operator=(const CatalogBuilder &);
+  flatbuffers::Offset<Catalog> Finish() {
+    auto o = flatbuffers::Offset<Catalog>(fbb_.EndTable(start_, 6));
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Catalog> CreateCatalog(flatbuffers::FlatBufferBuilder &_fbb,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Named>>> hashed = 0,
+   flatbuffers::Offset<flatbuffers::Vector<uint32_t>> hashed_hash_index = 0,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Named>>> named = 0,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Numbered>>> numbered = 0,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Typed>>> typed = 0,
+   int32_t count = 0) {
+  CatalogBuilder builder_(_fbb);
+  builder_.add_count(count);
+  builder_.add_typed(typed);
+  builder_.add_numbered(numbered);
+  builder_.add_named(named);
+  builder_.add_hashed_hash_index(hashed_hash_index);
+  builder_.add_hashed(hashed);
+  return builder_.Finish();
+}
+
+inline size_t CatalogSizeBound(size_t hashed_len = 0,
+   size_t hashed_hash_index_len = 0,
+   size_t named_len = 0,
+   size_t numbered_len = 0,
+   size_t typed_len = 0) {
+  return 17 + 12 * sizeof(flatbuffers::uoffset_t) +
+    flatbuffers::VectorSizeBound(hashed_len, sizeof(flatbuffers::uoffset_t), sizeof(flatbuffers::uoffset_t)) +
+    flatbuffers::VectorSizeBound(hashed_hash_index_len, 4, 4) +
+    flatbuffers::VectorSizeBound(named_len, sizeof(flatbuffers::uoffset_t), sizeof(flatbuffers::uoffset_t)) +
+    flatbuffers::VectorSizeBound(numbered_len, sizeof(flatbuffers::uoffset_t), sizeof(flatbuffers::uoffset_t)) +
+    flatbuffers::VectorSizeBound(typed_len, sizeof(flatbuffers::uoffset_t), sizeof(flatbuffers::uoffset_t));
+}
+
+#ifndef FLATBUFFERS_64BIT_OFFSETS  // Laid out for 32bit offsets.
+inline flatbuffers::Offset<Catalog> CreateCatalogDirect(flatbuffers::FlatBufferBuilder &_fbb,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Named>>> hashed,
+   flatbuffers::Offset<flatbuffers::Vector<uint32_t>> hashed_hash_index,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Named>>> named,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Numbered>>> numbered,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Typed>>> typed,
+   int32_t count) {
+  static const uint8_t _vtable[] = { 16, 0, 28, 0, 4, 0, 8, 0, 12, 0, 16, 0, 20, 0, 24, 0 };
+  auto _table = _fbb.StartDirectTable(28, 4);
+  _fbb.AddDirectOffset(_table, 4, hashed);
+  _fbb.AddDirectOffset(_table, 8, hashed_hash_index);
+  _fbb.AddDirectOffset(_table, 12, named);
+  _fbb.AddDirectOffset(_table, 16, numbered);
+  _fbb.AddDirectOffset(_table, 20, typed);
+  _fbb.AddDirectElement<int32_t>(_table, 24, count);
+  return flatbuffers::Offset<Catalog>(_fbb.EndDirectTable(_table, _vtable, 2563312517U));
+}
+#endif
+
+inline const flatbuffers::TableVerifyDesc *Named::VerifyDescriptor() {
+  static const flatbuffers::FieldVerifyDesc fields[] = {
+    { VT_NAME, "name", flatbuffers::FieldVerifyDesc::kString, true, 0, nullptr, 0, nullptr, 0, nullptr }
+  };
+  static const flatbuffers::TableVerifyDesc desc = { fields, 1 };
+  return &desc;
+}
+
+inline const flatbuffers::TableVerifyDesc *Numbered::VerifyDescriptor() {
+  static const flatbuffers::FieldVerifyDesc fields[] = {
+    { VT_NUMBER, "number", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int32_t), nullptr, 0, nullptr, 0, nullptr }
+  };
+  static const flatbuffers::TableVerifyDesc desc = { fields, 1 };
+  return &desc;
+}
+
+inline const flatbuffers::TableVerifyDesc *Typed::VerifyDescriptor() {
+  static const flatbuffers::FieldVerifyDesc fields[] = {
+    { VT_ELEMENT, "element", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(uint8_t), nullptr, 0, nullptr, 0, nullptr }
+  };
+  static const flatbuffers::TableVerifyDesc desc = { fields, 1 };
+  return &desc;
+}
+
+inline const flatbuffers::TableVerifyDesc *Catalog::VerifyDescriptor() {
+  static const flatbuffers::FieldVerifyDesc fields[] = {
+    { VT_HASHED, "hashed", flatbuffers::FieldVerifyDesc::kVectorOfTables, false, 0, &Named::VerifyDescriptor, 0, nullptr, 0, nullptr },
+    { VT_HASHED_HASH_INDEX, "hashed_hash_index", flatbuffers::FieldVerifyDesc::kVector, false, sizeof(uint32_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_NAMED, "named", flatbuffers::FieldVerifyDesc::kVectorOfTables, false, 0, &Named::VerifyDescriptor, 0, nullptr, 0, nullptr },
+    { VT_NUMBERED, "numbered", flatbuffers::FieldVerifyDesc::kVectorOfTables, false, 0, &Numbered::VerifyDescriptor, 0, nullptr, 0, nullptr },
+    { VT_TYPED, "typed", flatbuffers::FieldVerifyDesc::kVectorOfTables, false, 0, &Typed::VerifyDescriptor, 0, nullptr, 0, nullptr },
+    { VT_COUNT, "count", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int32_t), nullptr, 0, nullptr, 0, nullptr }
+  };
+  static const flatbuffers::TableVerifyDesc desc = { fields, 6 };
+  return &desc;
+}
+
+struct CheckedNamed FLATBUFFERS_FINAL_CLASS : private flatbuffers::CheckedTable {
+  CheckedNamed() {}
+  explicit CheckedNamed(const flatbuffers::CheckedTable &table)
+    : flatbuffers::CheckedTable(table) {}
+  using flatbuffers::CheckedTable::IsNull;
+  const flatbuffers::String *name() const { return GetString(Named::VT_NAME); }
+};
+
+struct CheckedNumbered FLATBUFFERS_FINAL_CLASS : private flatbuffers::CheckedTable {
+  CheckedNumbered() {}
+  explicit CheckedNumbered(const flatbuffers::CheckedTable &table)
+    : flatbuffers::CheckedTable(table) {}
+  using flatbuffers::CheckedTable::IsNull;
+  int32_t number() const { return GetField<int32_t>(Numbered::VT_NUMBER, 0); }
+};
+
+struct CheckedTyped FLATBUFFERS_FINAL_CLASS : private flatbuffers::CheckedTable {
+  CheckedTyped() {}
+  explicit CheckedTyped(const flatbuffers::CheckedTable &table)
+    : flatbuffers::CheckedTable(table) {}
+  using flatbuffers::CheckedTable::IsNull;
+  Element element() const { return static_cast<Element>(GetField<uint8_t>(Typed::VT_ELEMENT, 0)); }
+};
+
+struct CheckedCatalog FLATBUFFERS_FINAL_CLASS : private flatbuffers::CheckedTable {
+  CheckedCatalog() {}
+  explicit CheckedCatalog(const flatbuffers::CheckedTable &table)
+    : flatbuffers::CheckedTable(table) {}
+  using flatbuffers::CheckedTable::IsNull;
+  flatbuffers::CheckedVectorOfTables<CheckedNamed> hashed() const;
+  const flatbuffers::Vector<uint32_t> *hashed_hash_index() const { return GetVector<flatbuffers::Vector<uint32_t>>(Catalog::VT_HASHED_HASH_INDEX, sizeof(uint32_t)); }
+  flatbuffers::CheckedVectorOfTables<CheckedNamed> named() const;
+  flatbuffers::CheckedVectorOfTables<CheckedNumbered> numbered() const;
+  flatbuffers::CheckedVectorOfTables<CheckedTyped> typed() const;
+  int32_t count() const { return GetField<int32_t>(Catalog::VT_COUNT, 0); }
+};
+
+inline flatbuffers::CheckedVectorOfTables<CheckedNamed> CheckedCatalog::hashed() const {
+  return GetVectorOfTables<CheckedNamed>(Catalog::VT_HASHED);
+}
+
+inline flatbuffers::CheckedVectorOfTables<CheckedNamed> CheckedCatalog::named() const {
+  return GetVectorOfTables<CheckedNamed>(Catalog::VT_NAMED);
+}
+
+inline flatbuffers::CheckedVectorOfTables<CheckedNumbered> CheckedCatalog::numbered() const {
+  return GetVectorOfTables<CheckedNumbered>(Catalog::VT_NUMBERED);
+}
+
+inline flatbuffers::CheckedVectorOfTables<CheckedTyped> CheckedCatalog::typed() const {
+  return GetVectorOfTables<CheckedTyped>(Catalog::VT_TYPED);
+}
+
+inline const MyGame::KeyLookup::Catalog *GetCatalog(const void *buf) { return flatbuffers::GetRoot<MyGame::KeyLookup::Catalog>(buf); }
+
+inline const MyGame::KeyLookup::Catalog *GetSizePrefixedCatalog(const void *buf) { return flatbuffers::GetSizePrefixedRoot<MyGame::KeyLookup::Catalog>(buf); }
+
+inline CheckedCatalog GetCheckedCatalog(const flatbuffers::CheckedBuffer &buf) { return CheckedCatalog(buf.GetRootTable()); }
+
+inline Catalog *GetMutableCatalog(void *buf) { return flatbuffers::GetMutableRoot<Catalog>(buf); }
+
+inline bool VerifyCatalogBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifyBuffer<MyGame::KeyLookup::Catalog>(); }
+
+inline bool VerifySizePrefixedCatalogBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifySizePrefixedBuffer<MyGame::KeyLookup::Catalog>(); }
+
+inline void FinishCatalogBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<MyGame::KeyLookup::Catalog> root) { fbb.Finish(root); }
+
+inline void FinishSizePrefixedCatalogBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<MyGame::KeyLookup::Catalog> root) { fbb.FinishSizePrefixed(root); }
+
+}  // namespace KeyLookup
+}  // namespace MyGame
+
+#endif  // FLATBUFFERS_GENERATED_KEYLOOKUPTEST_MYGAME_KEYLOOKUP_H_
@@ -104,11 +104,13 @@ struct TestSimpleTableWithEnum FLATBUFFERS_FINAL_CLASS : private flatbuffers::Ta
   };
   Color color() const { return static_cast<Color>(GetField<int8_t>(VT_COLOR, 2)); }
   bool mutate_color(Color _color) { return SetField(VT_COLOR, static_cast<int8_t>(_color)); }
+  static void gather_color(const flatbuffers::Vector<flatbuffers::Offset<TestSimpleTableWithEnum>> &tables, int8_t *out) { flatbuffers::GatherField<int8_t>(tables, VT_COLOR, 2, out); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int8_t>(verifier, VT_COLOR) &&
            verifier.EndTable();
   }
+  static const flatbuffers::TableVerifyDesc *VerifyDescriptor();
 };
 
 struct TestSimpleTableWithEnumBuilder {
@@ -121,6 +123,9 @@ struct TestSimpleTableWithEnumBuilder {
     auto o = flatbuffers::Offset<TestSimpleTableWithEnum>(fbb_.EndTable(start_, 1));
     return o;
   }
+  flatbuffers::Offset<TestSimpleTableWithEnum> FinishShared() {
+    return flatbuffers::Offset<TestSimpleTableWithEnum>(fbb_.EndSharedTable(start_, 1));
+  }
 };
 
 inline flatbuffers::Offset<TestSimpleTableWithEnum> CreateTestSimpleTableWithEnum(flatbuffers::FlatBufferBuilder &_fbb,
@@ -130,6 +135,28 @@ inline flatbuffers::Offset<TestSimpleTableWithEnum> CreateTestSimpleTableWithEnu
   return builder_.Finish();
 }
 
+inline flatbuffers::Offset<TestSimpleTableWithEnum> CreateSharedTestSimpleTableWithEnum(flatbuffers::FlatBufferBuilder &_fbb,
+   Color color = Color_Green) {
+  _fbb.StartSharedTable(1);
+  TestSimpleTableWithEnumBuilder builder_(_fbb);
+  builder_.add_color(color);
+  return builder_.FinishShared();
+}
+
+inline size_t TestSimpleTableWithEnumSizeBound() {
+  return 6 + 2 * sizeof(flatbuffers::uoffset_t);
+}
+
+#ifndef FLATBUFFERS_64BIT_OFFSETS  // Laid out for 32bit offsets.
+inline flatbuffers::Offset<TestSimpleTableWithEnum> CreateTestSimpleTableWithEnumDirect(flatbuffers::FlatBufferBuilder &_fbb,
+   Color color) {
+  static const uint8_t _vtable[] = { 6, 0, 8, 0, 4, 0 };
+  auto _table = _fbb.StartDirectTable(8, 4);
+  _fbb.AddDirectElement<int8_t>(_table, 4, static_cast<int8_t>(color));
+  return flatbuffers::Offset<TestSimpleTableWithEnum>(_fbb.EndDirectTable(_table, _vtable, 2641594567U));
+}
+#endif
+
 struct Stat FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   enum {
     VT_ID = 4,
@@ -140,8 +167,10 @@ struct Stat FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   flatbuffers::String *mutable_id() { return GetPointer<flatbuffers::String *>(VT_ID); }
   int64_t val() const { return GetField<int64_t>(VT_VAL, 0); }
   bool mutate_val(int64_t _val) { return SetField(VT_VAL, _val); }
+  static void gather_val(const flatbuffers::Vector<flatbuffers::Offset<Stat>> &tables, int64_t *out) { flatbuffers::GatherField<int64_t>(tables, VT_VAL, 0, out); }
   uint16_t count() const { return GetField<uint16_t>(VT_COUNT, 0); }
   bool mutate_count(uint16_t _count) { return SetField(VT_COUNT, _count); }
+  static void gather_count(const flatbuffers::Vector<flatbuffers::Offset<Stat>> &tables, uint16_t *out) { flatbuffers::GatherField<uint16_t>(tables, VT_COUNT, 0, out); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<flatbuffers::uoffset_t>(verifier, VT_ID) &&
@@ -150,6 +179,7 @@ struct Stat FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyField<uint16_t>(verifier, VT_COUNT) &&
            verifier.EndTable();
   }
+  static const flatbuffers::TableVerifyDesc *VerifyDescriptor();
 };
 
 struct StatBuilder {
@@ -177,6 +207,25 @@ inline flatbuffers::Offset<Stat> CreateStat(flatbuffers::FlatBufferBuilder &_fbb
   return builder_.Finish();
 }
 
+inline size_t StatSizeBound(size_t id_len = 0) {
+  return 26 + 4 * sizeof(flatbuffers::uoffset_t) +
+    flatbuffers::StringSizeBound(id_len);
+}
+
+#ifndef FLATBUFFERS_64BIT_OFFSETS  // Laid out for 32bit offsets.
+inline flatbuffers::Offset<Stat> CreateStatDirect(flatbuffers::FlatBufferBuilder &_fbb,
+   flatbuffers::Offset<flatbuffers::String> id,
+   int64_t val,
+   uint16_t count) {
+  static const uint8_t _vtable[] = { 10, 0, 24, 0, 4, 0, 8, 0, 16, 0 };
+  auto _table = _fbb.StartDirectTable(24, 8);
+  _fbb.AddDirectElement<int64_t>(_table, 8, val);
+  _fbb.AddDirectOffset(_table, 4, id);
+  _fbb.AddDirectElement<uint16_t>(_table, 16, count);
+  return flatbuffers::Offset<Stat>(_fbb.EndDirectTable(_table, _vtable, 2748875235U));
+}
+#endif
+
 /// an example documentation comment: monster object
 struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   enum {
@@ -212,18 +261,23 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   Vec3 *mutable_pos() { return GetStruct<Vec3 *>(VT_POS); }
   int16_t mana() const { return GetField<int16_t>(VT_MANA, 150); }
   bool mutate_mana(int16_t _mana) { return SetField(VT_MANA, _mana); }
+  static void gather_mana(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, int16_t *out) { flatbuffers::GatherField<int16_t>(tables, VT_MANA, 150, out); }
   int16_t hp() const { return GetField<int16_t>(VT_HP, 100); }
   bool mutate_hp(int16_t _hp) { return SetField(VT_HP, _hp); }
+  static void gather_hp(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, int16_t *out) { flatbuffers::GatherField<int16_t>(tables, VT_HP, 100, out); }
   const flatbuffers::String *name() const { return GetPointer<const flatbuffers::String *>(VT_NAME); }
   flatbuffers::String *mutable_name() { return GetPointer<flatbuffers::String *>(VT_NAME); }
   bool KeyCompareLessThan(const Monster *o) const { return *name() < *o->name(); }
   int KeyCompareWithValue(const char *val) const { return strcmp(name()->c_str(), val); }
+  const flatbuffers::String *GetKeyValue() const { return name(); }
   const flatbuffers::Vector<uint8_t> *inventory() const { return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_INVENTORY); }
   flatbuffers::Vector<uint8_t> *mutable_inventory() { return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_INVENTORY); }
   Color color() const { return static_cast<Color>(GetField<int8_t>(VT_COLOR, 8)); }
   bool mutate_color(Color _color) { return SetField(VT_COLOR, static_cast<int8_t>(_color)); }
+  static void gather_color(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, int8_t *out) { flatbuffers::GatherField<int8_t>(tables, VT_COLOR, 8, out); }
   Any test_type() const { return static_cast<Any>(GetField<uint8_t>(VT_TEST_TYPE, 0)); }
   bool mutate_test_type(Any _test_type) { return SetField(VT_TEST_TYPE, static_cast<uint8_t>(_test_type)); }
+  static void gather_test_type(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, uint8_t *out) { flatbuffers::GatherField<uint8_t>(tables, VT_TEST_TYPE, 0, out); }
   const void *test() const { return GetPointer<const void *>(VT_TEST); }
   void *mutable_test() { return GetPointer<void *>(VT_TEST); }
   const flatbuffers::Vector<const Test *> *test4() const { return GetPointer<const flatbuffers::Vector<const Test *> *>(VT_TEST4); }
@@ -243,30 +297,42 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   Stat *mutable_testempty() { return GetPointer<Stat *>(VT_TESTEMPTY); }
   bool testbool() const { return GetField<uint8_t>(VT_TESTBOOL, 0) != 0; }
   bool mutate_testbool(bool _testbool) { return SetField(VT_TESTBOOL, static_cast<uint8_t>(_testbool)); }
+  static void gather_testbool(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, uint8_t *out) { flatbuffers::GatherField<uint8_t>(tables, VT_TESTBOOL, 0, out); }
   int32_t testhashs32_fnv1() const { return GetField<int32_t>(VT_TESTHASHS32_FNV1, 0); }
   bool mutate_testhashs32_fnv1(int32_t _testhashs32_fnv1) { return SetField(VT_TESTHASHS32_FNV1, _testhashs32_fnv1); }
+  static void gather_testhashs32_fnv1(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, int32_t *out) { flatbuffers::GatherField<int32_t>(tables, VT_TESTHASHS32_FNV1, 0, out); }
   uint32_t testhashu32_fnv1() const { return GetField<uint32_t>(VT_TESTHASHU32_FNV1, 0); }
   bool mutate_testhashu32_fnv1(uint32_t _testhashu32_fnv1) { return SetField(VT_TESTHASHU32_FNV1, _testhashu32_fnv1); }
+  static void gather_testhashu32_fnv1(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, uint32_t *out) { flatbuffers::GatherField<uint32_t>(tables, VT_TESTHASHU32_FNV1, 0, out); }
   int64_t testhashs64_fnv1() const { return GetField<int64_t>(VT_TESTHASHS64_FNV1, 0); }
   bool mutate_testhashs64_fnv1(int64_t _testhashs64_fnv1) { return SetField(VT_TESTHASHS64_FNV1, _testhashs64_fnv1); }
+  static void gather_testhashs64_fnv1(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, int64_t *out) { flatbuffers::GatherField<int64_t>(tables, VT_TESTHASHS64_FNV1, 0, out); }
   uint64_t testhashu64_fnv1() const { return GetField<uint64_t>(VT_TESTHASHU64_FNV1, 0); }
   bool mutate_testhashu64_fnv1(uint64_t _testhashu64_fnv1) { return SetField(VT_TESTHASHU64_FNV1, _testhashu64_fnv1); }
+  static void gather_testhashu64_fnv1(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, uint64_t *out) { flatbuffers::GatherField<uint64_t>(tables, VT_TESTHASHU64_FNV1, 0, out); }
   int32_t testhashs32_fnv1a() const { return GetField<int32_t>(VT_TESTHASHS32_FNV1A, 0); }
   bool mutate_testhashs32_fnv1a(int32_t _testhashs32_fnv1a) { return SetField(VT_TESTHASHS32_FNV1A, _testhashs32_fnv1a); }
+  static void gather_testhashs32_fnv1a(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, int32_t *out) { flatbuffers::GatherField<int32_t>(tables, VT_TESTHASHS32_FNV1A, 0, out); }
   uint32_t testhashu32_fnv1a() const { return GetField<uint32_t>(VT_TESTHASHU32_FNV1A, 0); }
   bool mutate_testhashu32_fnv1a(uint32_t _testhashu32_fnv1a) { return SetField(VT_TESTHASHU32_FNV1A, _testhashu32_fnv1a); }
+  static void gather_testhashu32_fnv1a(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, uint32_t *out) { flatbuffers::GatherField<uint32_t>(tables, VT_TESTHASHU32_FNV1A, 0, out); }
   int64_t testhashs64_fnv1a() const { return GetField<int64_t>(VT_TESTHASHS64_FNV1A, 0); }
   bool mutate_testhashs64_fnv1a(int64_t _testhashs64_fnv1a) { return SetField(VT_TESTHASHS64_FNV1A, _testhashs64_fnv1a); }
+  static void gather_testhashs64_fnv1a(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, int64_t *out) { flatbuffers::GatherField<int64_t>(tables, VT_TESTHASHS64_FNV1A, 0, out); }
   uint64_t testhashu64_fnv1a() const { return GetField<uint64_t>(VT_TESTHASHU64_FNV1A, 0); }
   bool mutate_testhashu64_fnv1a(uint64_t _testhashu64_fnv1a) { return SetField(VT_TESTHASHU64_FNV1A, _testhashu64_fnv1a); }
+  static void gather_testhashu64_fnv1a(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, uint64_t *out) { flatbuffers::GatherField<uint64_t>(tables, VT_TESTHASHU64_FNV1A, 0, out); }
   const flatbuffers::Vector<uint8_t> *testarrayofbools() const { return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_TESTARRAYOFBOOLS); }
   flatbuffers::Vector<uint8_t> *mutable_testarrayofbools() { return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_TESTARRAYOFBOOLS); }
   float testf() const { return GetField<float>(VT_TESTF, 3.14159f); }
   bool mutate_testf(float _testf) { return SetField(VT_TESTF, _testf); }
+  static void gather_testf(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, float *out) { flatbuffers::GatherField<float>(tables, VT_TESTF, 3.14159f, out); }
   float testf2() const { return GetField<float>(VT_TESTF2, 3.0f); }
   bool mutate_testf2(float _testf2) { return SetField(VT_TESTF2, _testf2); }
+  static void gather_testf2(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, float *out) { flatbuffers::GatherField<float>(tables, VT_TESTF2, 3.0f, out); }
   float testf3() const { return GetField<float>(VT_TESTF3, 0.0f); }
   bool mutate_testf3(float _testf3) { return SetField(VT_TESTF3, _testf3); }
+  static void gather_testf3(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, float *out) { flatbuffers::GatherField<float>(tables, VT_TESTF3, 0.0f, out); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<Vec3>(verifier, VT_POS) &&
@@ -310,6 +376,7 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyField<float>(verifier, VT_TESTF3) &&
            verifier.EndTable();
   }
+  static const flatbuffers::TableVerifyDesc *VerifyDescriptor();
 };
 
 struct MonsterBuilder {
@@ -410,21 +477,223 @@ inline flatbuffers::Offset<Monster> CreateMonster(flatbuffers::FlatBufferBuilder
   return builder_.Finish();
 }
 
+inline size_t MonsterSizeBound(size_t name_len = 0,
+   size_t inventory_len = 0,
+   size_t test4_len = 0,
+   size_t testarrayofstring_len = 0,
+   size_t testarrayoftables_len = 0,
+   size_t testnestedflatbuffer_len = 0,
+   size_t testarrayofbools_len = 0) {
+  return 214 + 22 * sizeof(flatbuffers::uoffset_t) +
+    flatbuffers::StringSizeBound(name_len) +
+    flatbuffers::VectorSizeBound(inventory_len, 1, 1) +
+    flatbuffers::VectorSizeBound(test4_len, 4, 2) +
+    flatbuffers::VectorSizeBound(testarrayofstring_len, sizeof(flatbuffers::uoffset_t), sizeof(flatbuffers::uoffset_t)) +
+    flatbuffers::VectorSizeBound(testarrayoftables_len, sizeof(flatbuffers::uoffset_t), sizeof(flatbuffers::uoffset_t)) +
+    flatbuffers::VectorSizeBound(testnestedflatbuffer_len, 1, 1) +
+    flatbuffers::VectorSizeBound(testarrayofbools_len, 1, 1);
+}
+
+#ifndef FLATBUFFERS_64BIT_OFFSETS  // Laid out for 32bit offsets.
+inline flatbuffers::Offset<Monster> CreateMonsterDirect(flatbuffers::FlatBufferBuilder &_fbb,
+   const Vec3 *pos,
+   int16_t mana,
+   int16_t hp,
+   flatbuffers::Offset<flatbuffers::String> name,
+   flatbuffers::Offset<flatbuffers::Vector<uint8_t>> inventory,
+   Color color,
+   Any test_type,
+   flatbuffers::Offset<void> test,
+   flatbuffers::Offset<flatbuffers::Vector<const Test *>> test4,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> testarrayofstring,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Monster>>> testarrayoftables,
+   flatbuffers::Offset<Monster> enemy,
+   flatbuffers::Offset<flatbuffers::Vector<uint8_t>> testnestedflatbuffer,
+   flatbuffers::Offset<Stat> testempty,
+   bool testbool,
+   int32_t testhashs32_fnv1,
+   uint32_t testhashu32_fnv1,
+   int64_t testhashs64_fnv1,
+   uint64_t testhashu64_fnv1,
+   int32_t testhashs32_fnv1a,
+   uint32_t testhashu32_fnv1a,
+   int64_t testhashs64_fnv1a,
+   uint64_t testhashu64_fnv1a,
+   flatbuffers::Offset<flatbuffers::Vector<uint8_t>> testarrayofbools,
+   float testf,
+   float testf2,
+   float testf3) {
+  static const uint8_t _vtable[] = { 60, 0, 144, 0, 16, 0, 136, 0, 138, 0, 4, 0, 0, 0, 72, 0, 140, 0, 141, 0, 76, 0, 80, 0, 84, 0, 88, 0, 92, 0, 96, 0, 100, 0, 142, 0, 104, 0, 108, 0, 8, 0, 48, 0, 112, 0, 116, 0, 56, 0, 64, 0, 120, 0, 124, 0, 128, 0, 132, 0 };
+  auto _table = _fbb.StartDirectTable(144, 16);
+  _fbb.AddDirectStruct(_table, 16, pos);
+  _fbb.AddDirectElement<int64_t>(_table, 8, testhashs64_fnv1);
+  _fbb.AddDirectElement<uint64_t>(_table, 48, testhashu64_fnv1);
+  _fbb.AddDirectElement<int64_t>(_table, 56, testhashs64_fnv1a);
+  _fbb.AddDirectElement<uint64_t>(_table, 64, testhashu64_fnv1a);
+  _fbb.AddDirectOffset(_table, 4, name);
+  _fbb.AddDirectOffset(_table, 72, inventory);
+  _fbb.AddDirectOffset(_table, 76, test);
+  _fbb.AddDirectOffset(_table, 80, test4);
+  _fbb.AddDirectOffset(_table, 84, testarrayofstring);
+  _fbb.AddDirectOffset(_table, 88, testarrayoftables);
+  _fbb.AddDirectOffset(_table, 92, enemy);
+  _fbb.AddDirectOffset(_table, 96, testnestedflatbuffer);
+  _fbb.AddDirectOffset(_table, 100, testempty);
+  _fbb.AddDirectElement<int32_t>(_table, 104, testhashs32_fnv1);
+  _fbb.AddDirectElement<uint32_t>(_table, 108, testhashu32_fnv1);
+  _fbb.AddDirectElement<int32_t>(_table, 112, testhashs32_fnv1a);
+  _fbb.AddDirectElement<uint32_t>(_table, 116, testhashu32_fnv1a);
+  _fbb.AddDirectOffset(_table, 120, testarrayofbools);
+  _fbb.AddDirectElement<float>(_table, 124, testf);
+  _fbb.AddDirectElement<float>(_table, 128, testf2);
+  _fbb.AddDirectElement<float>(_table, 132, testf3);
+  _fbb.AddDirectElement<int16_t>(_table, 136, mana);
+  _fbb.AddDirectElement<int16_t>(_table, 138, hp);
+  _fbb.AddDirectElement<int8_t>(_table, 140, static_cast<int8_t>(color));
+  _fbb.AddDirectElement<uint8_t>(_table, 141, static_cast<uint8_t>(test_type));
+  _fbb.AddDirectElement<uint8_t>(_table, 142, static_cast<uint8_t>(testbool));
+  return flatbuffers::Offset<Monster>(_fbb.EndDirectTable(_table, _vtable, 3610351096U));
+}
+#endif
+
 inline bool VerifyAny(flatbuffers::Verifier &verifier, const void *union_obj, Any type) {
   switch (type) {
     case Any_NONE: return true;
     case Any_Monster: return verifier.VerifyTable(reinterpret_cast<const Monster *>(union_obj));
     case Any_TestSimpleTableWithEnum: return verifier.VerifyTable(reinterpret_cast<const TestSimpleTableWithEnum *>(union_obj));
-    default: return false;
+    default: return verifier.Check(false, "unknown union type", union_obj);
   }
 }
 
+inline const flatbuffers::TableVerifyDesc *TestSimpleTableWithEnum::VerifyDescriptor() {
+  static const flatbuffers::FieldVerifyDesc fields[] = {
+    { VT_COLOR, "color", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int8_t), nullptr, 0, nullptr, 0, nullptr }
+  };
+  static const flatbuffers::TableVerifyDesc desc = { fields, 1 };
+  return &desc;
+}
+
+inline const flatbuffers::TableVerifyDesc *Stat::VerifyDescriptor() {
+  static const flatbuffers::FieldVerifyDesc fields[] = {
+    { VT_ID, "id", flatbuffers::FieldVerifyDesc::kString, false, 0, nullptr, 0, nullptr, 0, nullptr },
+    { VT_VAL, "val", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int64_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_COUNT, "count", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(uint16_t), nullptr, 0, nullptr, 0, nullptr }
+  };
+  static const flatbuffers::TableVerifyDesc desc = { fields, 3 };
+  return &desc;
+}
+
+inline const flatbuffers::TableVerifyDesc *Monster::VerifyDescriptor() {
+  static const flatbuffers::TableVerifyDescFn test_tables[] = { nullptr, &Monster::VerifyDescriptor, &TestSimpleTableWithEnum::VerifyDescriptor };
+  static const flatbuffers::FieldVerifyDesc fields[] = {
+    { VT_POS, "pos", flatbuffers::FieldVerifyDesc::kStruct, false, sizeof(Vec3), nullptr, 0, nullptr, 0, nullptr },
+    { VT_MANA, "mana", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int16_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_HP, "hp", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int16_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_NAME, "name", flatbuffers::FieldVerifyDesc::kString, true, 0, nullptr, 0, nullptr, 0, nullptr },
+    { VT_INVENTORY, "inventory", flatbuffers::FieldVerifyDesc::kVector, false, sizeof(uint8_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_COLOR, "color", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int8_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_TEST_TYPE, "test_type", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(uint8_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_TEST, "test", flatbuffers::FieldVerifyDesc::kUnion, false, 0, nullptr, VT_TEST_TYPE, test_tables, 3, nullptr },
+    { VT_TEST4, "test4", flatbuffers::FieldVerifyDesc::kVector, false, sizeof(Test), nullptr, 0, nullptr, 0, nullptr },
+    { VT_TESTARRAYOFSTRING, "testarrayofstring", flatbuffers::FieldVerifyDesc::kVectorOfStrings, false, 0, nullptr, 0, nullptr, 0, nullptr },
+    { VT_TESTARRAYOFTABLES, "testarrayoftables", flatbuffers::FieldVerifyDesc::kVectorOfTables, false, 0, &Monster::VerifyDescriptor, 0, nullptr, 0, nullptr },
+    { VT_ENEMY, "enemy", flatbuffers::FieldVerifyDesc::kTable, false, 0, &Monster::VerifyDescriptor, 0, nullptr, 0, nullptr },
+    { VT_TESTNESTEDFLATBUFFER, "testnestedflatbuffer", flatbuffers::FieldVerifyDesc::kVector, false, sizeof(uint8_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_TESTEMPTY, "testempty", flatbuffers::FieldVerifyDesc::kTable, false, 0, &Stat::VerifyDescriptor, 0, nullptr, 0, nullptr },
+    { VT_TESTBOOL, "testbool", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(uint8_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_TESTHASHS32_FNV1, "testhashs32_fnv1", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int32_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_TESTHASHU32_FNV1, "testhashu32_fnv1", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(uint32_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_TESTHASHS64_FNV1, "testhashs64_fnv1", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int64_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_TESTHASHU64_FNV1, "testhashu64_fnv1", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(uint64_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_TESTHASHS32_FNV1A, "testhashs32_fnv1a", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int32_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_TESTHASHU32_FNV1A, "testhashu32_fnv1a", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(uint32_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_TESTHASHS64_FNV1A, "testhashs64_fnv1a", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int64_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_TESTHASHU64_FNV1A, "testhashu64_fnv1a", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(uint64_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_TESTARRAYOFBOOLS, "testarrayofbools", flatbuffers::FieldVerifyDesc::kVector, false, sizeof(uint8_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_TESTF, "testf", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(float), nullptr, 0, nullptr, 0, nullptr },
+    { VT_TESTF2, "testf2", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(float), nullptr, 0, nullptr, 0, nullptr },
+    { VT_TESTF3, "testf3", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(float), nullptr, 0, nullptr, 0, nullptr }
+  };
+  static const flatbuffers::TableVerifyDesc desc = { fields, 27 };
+  return &desc;
+}
+
+struct CheckedTestSimpleTableWithEnum FLATBUFFERS_FINAL_CLASS : private flatbuffers::CheckedTable {
+  CheckedTestSimpleTableWithEnum() {}
+  explicit CheckedTestSimpleTableWithEnum(const flatbuffers::CheckedTable &table)
+    : flatbuffers::CheckedTable(table) {}
+  using flatbuffers::CheckedTable::IsNull;
+  Color color() const { return static_cast<Color>(GetField<int8_t>(TestSimpleTableWithEnum::VT_COLOR, 2)); }
+};
+
+struct CheckedStat FLATBUFFERS_FINAL_CLASS : private flatbuffers::CheckedTable {
+  CheckedStat() {}
+  explicit CheckedStat(const flatbuffers::CheckedTable &table)
+    : flatbuffers::CheckedTable(table) {}
+  using flatbuffers::CheckedTable::IsNull;
+  const flatbuffers::String *id() const { return GetString(Stat::VT_ID); }
+  int64_t val() const { return GetField<int64_t>(Stat::VT_VAL, 0); }
+  uint16_t count() const { return GetField<uint16_t>(Stat::VT_COUNT, 0); }
+};
+
+struct CheckedMonster FLATBUFFERS_FINAL_CLASS : private flatbuffers::CheckedTable {
+  CheckedMonster() {}
+  explicit CheckedMonster(const flatbuffers::CheckedTable &table)
+    : flatbuffers::CheckedTable(table) {}
+  using flatbuffers::CheckedTable::IsNull;
+  const Vec3 *pos() const { return GetStruct<Vec3>(Monster::VT_POS); }
+  int16_t mana() const { return GetField<int16_t>(Monster::VT_MANA, 150); }
+  int16_t hp() const { return GetField<int16_t>(Monster::VT_HP, 100); }
+  const flatbuffers::String *name() const { return GetString(Monster::VT_NAME); }
+  const flatbuffers::Vector<uint8_t> *inventory() const { return GetVector<flatbuffers::Vector<uint8_t>>(Monster::VT_INVENTORY, sizeof(uint8_t)); }
+  Color color() const { return static_cast<Color>(GetField<int8_t>(Monster::VT_COLOR, 8)); }
+  Any test_type() const { return static_cast<Any>(GetField<uint8_t>(Monster::VT_TEST_TYPE, 0)); }
+  flatbuffers::CheckedTable test() const { return GetTable(Monster::VT_TEST); }
+  const flatbuffers::Vector<const Test *> *test4() const { return GetVector<flatbuffers::Vector<const Test *>>(Monster::VT_TEST4, sizeof(Test)); }
+  flatbuffers::CheckedVectorOfStrings testarrayofstring() const { return GetVectorOfStrings(Monster::VT_TESTARRAYOFSTRING); }
+  flatbuffers::CheckedVectorOfTables<CheckedMonster> testarrayoftables() const;
+  CheckedMonster enemy() const;
+  const flatbuffers::Vector<uint8_t> *testnestedflatbuffer() const { return GetVector<flatbuffers::Vector<uint8_t>>(Monster::VT_TESTNESTEDFLATBUFFER, sizeof(uint8_t)); }
+  CheckedStat testempty() const;
+  bool testbool() const { return GetField<uint8_t>(Monster::VT_TESTBOOL, 0) != 0; }
+  int32_t testhashs32_fnv1() const { return GetField<int32_t>(Monster::VT_TESTHASHS32_FNV1, 0); }
+  uint32_t testhashu32_fnv1() const { return GetField<uint32_t>(Monster::VT_TESTHASHU32_FNV1, 0); }
+  int64_t testhashs64_fnv1() const { return GetField<int64_t>(Monster::VT_TESTHASHS64_FNV1, 0); }
+  uint64_t testhashu64_fnv1() const { return GetField<uint64_t>(Monster::VT_TESTHASHU64_FNV1, 0); }
+  int32_t testhashs32_fnv1a() const { return GetField<int32_t>(Monster::VT_TESTHASHS32_FNV1A, 0); }
+  uint32_t testhashu32_fnv1a() const { return GetField<uint32_t>(Monster::VT_TESTHASHU32_FNV1A, 0); }
+  int64_t testhashs64_fnv1a() const { return GetField<int64_t>(Monster::VT_TESTHASHS64_FNV1A, 0); }
+  uint64_t testhashu64_fnv1a() const { return GetField<uint64_t>(Monster::VT_TESTHASHU64_FNV1A, 0); }
+  const flatbuffers::Vector<uint8_t> *testarrayofbools() const { return GetVector<flatbuffers::Vector<uint8_t>>(Monster::VT_TESTARRAYOFBOOLS, sizeof(uint8_t)); }
+  float testf() const { return GetField<float>(Monster::VT_TESTF, 3.14159f); }
+  float testf2() const { return GetField<float>(Monster::VT_TESTF2, 3.0f); }
+  float testf3() const { return GetField<float>(Monster::VT_TESTF3, 0.0f); }
+};
+
+inline flatbuffers::CheckedVectorOfTables<CheckedMonster> CheckedMonster::testarrayoftables() const {
+  return GetVectorOfTables<CheckedMonster>(Monster::VT_TESTARRAYOFTABLES);
+}
+
+inline CheckedMonster CheckedMonster::enemy() const {
+  return CheckedMonster(GetTable(Monster::VT_ENEMY));
+}
+
+inline CheckedStat CheckedMonster::testempty() const {
+  return CheckedStat(GetTable(Monster::VT_TESTEMPTY));
+}
+
 inline const MyGame::Example::Monster *GetMonster(const void *buf) { return flatbuffers::GetRoot<MyGame::Example::Monster>(buf); }
 
+inline const MyGame::Example::Monster *GetSizePrefixedMonster(const void *buf) { return flatbuffers::GetSizePrefixedRoot<MyGame::Example::Monster>(buf); }
+
+inline CheckedMonster GetCheckedMonster(const flatbuffers::CheckedBuffer &buf) { return CheckedMonster(buf.GetRootTable()); }
+
 inline Monster *GetMutableMonster(void *buf) { return flatbuffers::GetMutableRoot<Monster>(buf); }
 
 inline bool VerifyMonsterBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifyBuffer<MyGame::Example::Monster>(); }
 
+inline bool VerifySizePrefixedMonsterBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifySizePrefixedBuffer<MyGame::Example::Monster>(); }
+
 inline const char *MonsterIdentifier() { return "MONS"; }
 
 inline bool MonsterBufferHasIdentifier(const void *buf) { return flatbuffers::BufferHasIdentifier(buf, MonsterIdentifier()); }
@@ -433,6 +702,8 @@ inline const char *MonsterExtension() { return "mon"; }
 
 inline void FinishMonsterBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<MyGame::Example::Monster> root) { fbb.Finish(root, MonsterIdentifier()); }
 
+inline void FinishSizePrefixedMonsterBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<MyGame::Example::Monster> root) { fbb.FinishSizePrefixed(root, MonsterIdentifier()); }
+
 }  // namespace Example
 }  // namespace MyGame
 
@@ -49,11 +49,13 @@ struct TableInNestedNS FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   };
   int32_t foo() const { return GetField<int32_t>(VT_FOO, 0); }
   bool mutate_foo(int32_t _foo) { return SetField(VT_FOO, _foo); }
+  static void gather_foo(const flatbuffers::Vector<flatbuffers::Offset<TableInNestedNS>> &tables, int32_t *out) { flatbuffers::GatherField<int32_t>(tables, VT_FOO, 0, out); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int32_t>(verifier, VT_FOO) &&
            verifier.EndTable();
   }
+  static const flatbuffers::TableVerifyDesc *VerifyDescriptor();
 };
 
 struct TableInNestedNSBuilder {
@@ -66,6 +68,9 @@ struct TableInNestedNSBuilder {
     auto o = flatbuffers::Offset<TableInNestedNS>(fbb_.EndTable(start_, 1));
     return o;
   }
+  flatbuffers::Offset<TableInNestedNS> FinishShared() {
+    return flatbuffers::Offset<TableInNestedNS>(fbb_.EndSharedTable(start_, 1));
+  }
 };
 
 inline flatbuffers::Offset<TableInNestedNS> CreateTableInNestedNS(flatbuffers::FlatBufferBuilder &_fbb,
@@ -75,6 +80,36 @@ inline flatbuffers::Offset<TableInNestedNS> CreateTableInNestedNS(flatbuffers::F
   return builder_.Finish();
 }
 
+inline flatbuffers::Offset<TableInNestedNS> CreateSharedTableInNestedNS(flatbuffers::FlatBufferBuilder &_fbb,
+   int32_t foo = 0) {
+  _fbb.StartSharedTable(4);
+  TableInNestedNSBuilder builder_(_fbb);
+  builder_.add_foo(foo);
+  return builder_.FinishShared();
+}
+
+inline size_t TableInNestedNSSizeBound() {
+  return 12 + 2 * sizeof(flatbuffers::uoffset_t);
+}
+
+#ifndef FLATBUFFERS_64BIT_OFFSETS  // Laid out for 32bit offsets.
+inline flatbuffers::Offset<TableInNestedNS> CreateTableInNestedNSDirect(flatbuffers::FlatBufferBuilder &_fbb,
+   int32_t foo) {
+  static const uint8_t _vtable[] = { 6, 0, 8, 0, 4, 0 };
+  auto _table = _fbb.StartDirectTable(8, 4);
+  _fbb.AddDirectElement<int32_t>(_table, 4, foo);
+  return flatbuffers::Offset<TableInNestedNS>(_fbb.EndDirectTable(_table, _vtable, 2641594567U));
+}
+#endif
+
+inline const flatbuffers::TableVerifyDesc *TableInNestedNS::VerifyDescriptor() {
+  static const flatbuffers::FieldVerifyDesc fields[] = {
+    { VT_FOO, "foo", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int32_t), nullptr, 0, nullptr, 0, nullptr }
+  };
+  static const flatbuffers::TableVerifyDesc desc = { fields, 1 };
+  return &desc;
+}
+
 }  // namespace NamespaceB
 }  // namespace NamespaceA
 
@@ -37,6 +37,7 @@ struct TableInFirstNS FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   NamespaceA::NamespaceB::TableInNestedNS *mutable_foo_table() { return GetPointer<NamespaceA::NamespaceB::TableInNestedNS *>(VT_FOO_TABLE); }
   NamespaceA::NamespaceB::EnumInNestedNS foo_enum() const { return static_cast<NamespaceA::NamespaceB::EnumInNestedNS>(GetField<int8_t>(VT_FOO_ENUM, 0)); }
   bool mutate_foo_enum(NamespaceA::NamespaceB::EnumInNestedNS _foo_enum) { return SetField(VT_FOO_ENUM, static_cast<int8_t>(_foo_enum)); }
+  static void gather_foo_enum(const flatbuffers::Vector<flatbuffers::Offset<TableInFirstNS>> &tables, int8_t *out) { flatbuffers::GatherField<int8_t>(tables, VT_FOO_ENUM, 0, out); }
   const NamespaceA::NamespaceB::StructInNestedNS *foo_struct() const { return GetStruct<const NamespaceA::NamespaceB::StructInNestedNS *>(VT_FOO_STRUCT); }
   NamespaceA::NamespaceB::StructInNestedNS *mutable_foo_struct() { return GetStruct<NamespaceA::NamespaceB::StructInNestedNS *>(VT_FOO_STRUCT); }
   bool Verify(flatbuffers::Verifier &verifier) const {
@@ -47,6 +48,7 @@ struct TableInFirstNS FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyField<NamespaceA::NamespaceB::StructInNestedNS>(verifier, VT_FOO_STRUCT) &&
            verifier.EndTable();
   }
+  static const flatbuffers::TableVerifyDesc *VerifyDescriptor();
 };
 
 struct TableInFirstNSBuilder {
@@ -74,6 +76,24 @@ inline flatbuffers::Offset<TableInFirstNS> CreateTableInFirstNS(flatbuffers::Fla
   return builder_.Finish();
 }
 
+inline size_t TableInFirstNSSizeBound() {
+  return 20 + 4 * sizeof(flatbuffers::uoffset_t);
+}
+
+#ifndef FLATBUFFERS_64BIT_OFFSETS  // Laid out for 32bit offsets.
+inline flatbuffers::Offset<TableInFirstNS> CreateTableInFirstNSDirect(flatbuffers::FlatBufferBuilder &_fbb,
+   flatbuffers::Offset<NamespaceA::NamespaceB::TableInNestedNS> foo_table,
+   NamespaceA::NamespaceB::EnumInNestedNS foo_enum,
+   const NamespaceA::NamespaceB::StructInNestedNS *foo_struct) {
+  static const uint8_t _vtable[] = { 10, 0, 20, 0, 12, 0, 16, 0, 4, 0 };
+  auto _table = _fbb.StartDirectTable(20, 4);
+  _fbb.AddDirectStruct(_table, 4, foo_struct);
+  _fbb.AddDirectOffset(_table, 12, foo_table);
+  _fbb.AddDirectElement<int8_t>(_table, 16, static_cast<int8_t>(foo_enum));
+  return flatbuffers::Offset<TableInFirstNS>(_fbb.EndDirectTable(_table, _vtable, 2315505851U));
+}
+#endif
+
 }  // namespace NamespaceA
 
 namespace NamespaceC {
@@ -95,6 +115,7 @@ struct TableInC FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            verifier.VerifyTable(refer_to_a2()) &&
            verifier.EndTable();
   }
+  static const flatbuffers::TableVerifyDesc *VerifyDescriptor();
 };
 
 struct TableInCBuilder {
@@ -119,6 +140,22 @@ inline flatbuffers::Offset<TableInC> CreateTableInC(flatbuffers::FlatBufferBuild
   return builder_.Finish();
 }
 
+inline size_t TableInCSizeBound() {
+  return 5 + 6 * sizeof(flatbuffers::uoffset_t);
+}
+
+#ifndef FLATBUFFERS_64BIT_OFFSETS  // Laid out for 32bit offsets.
+inline flatbuffers::Offset<TableInC> CreateTableInCDirect(flatbuffers::FlatBufferBuilder &_fbb,
+   flatbuffers::Offset<NamespaceA::TableInFirstNS> refer_to_a1,
+   flatbuffers::Offset<NamespaceA::SecondTableInA> refer_to_a2) {
+  static const uint8_t _vtable[] = { 8, 0, 12, 0, 4, 0, 8, 0 };
+  auto _table = _fbb.StartDirectTable(12, 4);
+  _fbb.AddDirectOffset(_table, 4, refer_to_a1);
+  _fbb.AddDirectOffset(_table, 8, refer_to_a2);
+  return flatbuffers::Offset<TableInC>(_fbb.EndDirectTable(_table, _vtable, 2296476493U));
+}
+#endif
+
 }  // namespace NamespaceC
 
 namespace NamespaceA {
@@ -135,6 +172,7 @@ struct SecondTableInA FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            verifier.VerifyTable(refer_to_c()) &&
            verifier.EndTable();
   }
+  static const flatbuffers::TableVerifyDesc *VerifyDescriptor();
 };
 
 struct SecondTableInABuilder {
@@ -156,6 +194,59 @@ inline flatbuffers::Offset<SecondTableInA> CreateSecondTableInA(flatbuffers::Fla
   return builder_.Finish();
 }
 
+inline size_t SecondTableInASizeBound() {
+  return 4 + 4 * sizeof(flatbuffers::uoffset_t);
+}
+
+#ifndef FLATBUFFERS_64BIT_OFFSETS  // Laid out for 32bit offsets.
+inline flatbuffers::Offset<SecondTableInA> CreateSecondTableInADirect(flatbuffers::FlatBufferBuilder &_fbb,
+   flatbuffers::Offset<NamespaceC::TableInC> refer_to_c) {
+  static const uint8_t _vtable[] = { 6, 0, 8, 0, 4, 0 };
+  auto _table = _fbb.StartDirectTable(8, 4);
+  _fbb.AddDirectOffset(_table, 4, refer_to_c);
+  return flatbuffers::Offset<SecondTableInA>(_fbb.EndDirectTable(_table, _vtable, 2641594567U));
+}
+#endif
+
+}  // namespace NamespaceA
+
+namespace NamespaceA {
+
+inline const flatbuffers::TableVerifyDesc *TableInFirstNS::VerifyDescriptor() {
+  static const flatbuffers::FieldVerifyDesc fields[] = {
+    { VT_FOO_TABLE, "foo_table", flatbuffers::FieldVerifyDesc::kTable, false, 0, &NamespaceA::NamespaceB::TableInNestedNS::VerifyDescriptor, 0, nullptr, 0, nullptr },
+    { VT_FOO_ENUM, "foo_enum", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(int8_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_FOO_STRUCT, "foo_struct", flatbuffers::FieldVerifyDesc::kStruct, false, sizeof(NamespaceA::NamespaceB::StructInNestedNS), nullptr, 0, nullptr, 0, nullptr }
+  };
+  static const flatbuffers::TableVerifyDesc desc = { fields, 3 };
+  return &desc;
+}
+
+}  // namespace NamespaceA
+
+namespace NamespaceC {
+
+inline const flatbuffers::TableVerifyDesc *TableInC::VerifyDescriptor() {
+  static const flatbuffers::FieldVerifyDesc fields[] = {
+    { VT_REFER_TO_A1, "refer_to_a1", flatbuffers::FieldVerifyDesc::kTable, false, 0, &NamespaceA::TableInFirstNS::VerifyDescriptor, 0, nullptr, 0, nullptr },
+    { VT_REFER_TO_A2, "refer_to_a2", flatbuffers::FieldVerifyDesc::kTable, false, 0, &NamespaceA::SecondTableInA::VerifyDescriptor, 0, nullptr, 0, nullptr }
+  };
+  static const flatbuffers::TableVerifyDesc desc = { fields, 2 };
+  return &desc;
+}
+
+}  // namespace NamespaceC
+
+namespace NamespaceA {
+
+inline const flatbuffers::TableVerifyDesc *SecondTableInA::VerifyDescriptor() {
+  static const flatbuffers::FieldVerifyDesc fields[] = {
+    { VT_REFER_TO_C, "refer_to_c", flatbuffers::FieldVerifyDesc::kTable, false, 0, &NamespaceC::TableInC::VerifyDescriptor, 0, nullptr, 0, nullptr }
+  };
+  static const flatbuffers::TableVerifyDesc desc = { fields, 1 };
+  return &desc;
+}
+
 }  // namespace NamespaceA
 
 #endif  // FLATBUFFERS_GENERATED_NAMESPACETEST2_NAMESPACEA_H_
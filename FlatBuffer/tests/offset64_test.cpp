@@ -0,0 +1,182 @@
+/*
+ * Copyright 2014 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Tests for builds with FLATBUFFERS_64BIT_OFFSETS, which can't use the
+// 32bit offset schemas and data that test.cpp is built around.
+
+#define FLATBUFFERS_DEBUG_VERIFICATION_FAILURE 1
+
+#include "flatbuffers/flatbuffers.h"
+#include "flatbuffers/idl.h"
+#include "flatbuffers/util.h"
+
+#include "offset64_test_generated.h"
+
+using namespace MyGame::Offset64;
+
+#define TEST_OUTPUT_LINE(...) \
+  { printf(__VA_ARGS__); printf("\n"); }
+
+int testing_fails = 0;
+
+void TestFail(const char *expval, const char *val, const char *exp,
+              const char *file, int line) {
+  TEST_OUTPUT_LINE("TEST FAILED: %s:%d, %s (%s) != %s", file, line,
+                   exp, expval, val);
+  assert(0);
+  testing_fails++;
+}
+
+void TestEqStr(const char *expval, const char *val, const char *exp,
+               const char *file, int line) {
+  if (strcmp(expval, val) != 0) {
+    TestFail(expval, val, exp, file, line);
+  }
+}
+
+template<typename T, typename U>
+void TestEq(T expval, U val, const char *exp, const char *file, int line) {
+  if (U(expval) != val) {
+    TestFail(flatbuffers::NumToString(expval).c_str(),
+             flatbuffers::NumToString(val).c_str(),
+             exp, file, line);
+  }
+}
+
+#define TEST_EQ(exp, val) TestEq(exp,         val,   #exp, __FILE__, __LINE__)
+#define TEST_NOTNULL(exp) TestEq(exp == NULL, false, #exp, __FILE__, __LINE__)
+#define TEST_EQ_STR(exp, val) TestEqStr(exp,  val,   #exp, __FILE__, __LINE__)
+
+void OffsetSizeTest() {
+  TEST_EQ(sizeof(flatbuffers::uoffset_t), 8u);
+  TEST_EQ(sizeof(flatbuffers::soffset_t), 8u);
+}
+
+// Build a buffer with the generated code, and read it back.
+void GeneratedRoundTripTest() {
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<flatbuffers::Offset<Layer>> layers;
+  for (int i = 0; i < 3; i++) {
+    Point points[] = { Point(1.0f * i, 2.0f), Point(3.0f, 4.0f * i) };
+    std::vector<double> weights(static_cast<size_t>(i) + 1, 0.5 * i);
+    auto name = builder.CreateString("L" + flatbuffers::NumToString(2 - i));
+    auto point_vec = builder.CreateVectorOfStructs(points, 2);
+    auto weight_vec = builder.CreateVector(weights);
+    layers.push_back(i % 2
+      ? CreateLayer(builder, name, point_vec, weight_vec)
+      : CreateLayerDirect(builder, name, point_vec, weight_vec));
+  }
+  auto layer_vec = builder.CreateVectorOfSortedTables(&layers);
+  auto tag_vec = builder.CreateVectorOfStrings(2, [](size_t i) {
+    return i ? "bc" : "a";
+  });
+  Point origin(-1.0f, -2.0f);
+  FinishSnapshotBuffer(builder, CreateSnapshot(builder, 0x123456789ull,
+                                               &origin, layer_vec, tag_vec));
+
+  auto buf = builder.GetBufferPointer();
+  // The root offset is 64bit, followed by the identifier.
+  TEST_EQ(flatbuffers::ReadScalar<uint64_t>(buf) < builder.GetSize(), true);
+  TEST_EQ(memcmp(buf + sizeof(uint64_t), "SNAP", 4), 0);
+  TEST_EQ(SnapshotBufferHasIdentifier(buf), true);
+  flatbuffers::Verifier verifier(buf, builder.GetSize());
+  TEST_EQ(VerifySnapshotBuffer(verifier), true);
+
+  auto snapshot = GetSnapshot(buf);
+  TEST_EQ(snapshot->id(), 0x123456789ull);
+  TEST_EQ(snapshot->origin()->y(), -2.0f);
+  TEST_EQ(snapshot->tags()->size(), 2u);
+  TEST_EQ_STR(snapshot->tags()->Get(1)->c_str(), "bc");
+  TEST_EQ(snapshot->layers()->size(), 3u);
+  for (int i = 0; i < 3; i++) {
+    auto layer = snapshot->layers()->LookupByKey(
+      ("L" + flatbuffers::NumToString(2 - i)).c_str());
+    TEST_NOTNULL(layer);
+    TEST_EQ(layer->points()->Get(0)->x(), 1.0f * i);
+    TEST_EQ(layer->points()->Get(1)->y(), 4.0f * i);
+    TEST_EQ(layer->weights()->size(),
+            static_cast<flatbuffers::uoffset_t>(i + 1));
+    TEST_EQ(layer->weights()->Get(0), 0.5 * i);
+  }
+
+  // Truncated buffers are rejected.
+  flatbuffers::Verifier truncated(buf, builder.GetSize() - 8);
+  truncated.EnableDiagnostics();
+  TEST_EQ(VerifySnapshotBuffer(truncated), false);
+}
+
+// Parse JSON into a buffer, and generate the same JSON back from it.
+void JsonRoundTripTest() {
+  std::string schemafile;
+  TEST_EQ(flatbuffers::LoadFile("tests/offset64_test.fbs", false,
+                                &schemafile), true);
+  const char *json =
+    "{\n"
+    "  id: 42,\n"
+    "  origin: {\n"
+    "    x: 1,\n"
+    "    y: 2\n"
+    "  },\n"
+    "  layers: [\n"
+    "    {\n"
+    "      name: \"ground\",\n"
+    "      points: [\n"
+    "        {\n"
+    "          x: 0,\n"
+    "          y: 1.5\n"
+    "        }\n"
+    "      ],\n"
+    "      weights: [\n"
+    "        0.25,\n"
+    "        4\n"
+    "      ]\n"
+    "    }\n"
+    "  ],\n"
+    "  tags: [\n"
+    "    \"x\"\n"
+    "  ]\n"
+    "}\n";
+  flatbuffers::Parser parser;
+  TEST_EQ(parser.Parse(schemafile.c_str()), true);
+  TEST_EQ(parser.UsesOffset64(), true);
+  TEST_EQ(parser.Parse(json), true);
+
+  flatbuffers::Verifier verifier(parser.builder_.GetBufferPointer(),
+                                 parser.builder_.GetSize());
+  TEST_EQ(VerifySnapshotBuffer(verifier), true);
+  auto snapshot = GetSnapshot(parser.builder_.GetBufferPointer());
+  TEST_EQ(snapshot->id(), 42u);
+  TEST_EQ_STR(snapshot->layers()->Get(0)->name()->c_str(), "ground");
+  TEST_EQ(snapshot->layers()->Get(0)->weights()->Get(1), 4.0);
+
+  std::string text;
+  GenerateText(parser, parser.builder_.GetBufferPointer(), &text);
+  TEST_EQ_STR(text.c_str(), json);
+}
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  OffsetSizeTest();
+  GeneratedRoundTripTest();
+  JsonRoundTripTest();
+
+  if (!testing_fails) {
+    TEST_OUTPUT_LINE("ALL TESTS PASSED");
+    return 0;
+  } else {
+    TEST_OUTPUT_LINE("%d FAILED TESTS", testing_fails);
+    return 1;
+  }
+}
@@ -0,0 +1,260 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+#ifndef FLATBUFFERS_GENERATED_OFFSET64TEST_MYGAME_OFFSET64_H_
+#define FLATBUFFERS_GENERATED_OFFSET64TEST_MYGAME_OFFSET64_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+static_assert(sizeof(flatbuffers::uoffset_t) == 8,
+              "offset64_test.fbs uses 64bit offsets, define FLATBUFFERS_64BIT_OFFSETS");
+
+namespace MyGame {
+namespace Offset64 {
+
+struct Point;
+
+struct Layer;
+
+struct Snapshot;
+
+MANUALLY_ALIGNED_STRUCT(4) Point FLATBUFFERS_FINAL_CLASS {
+ private:
+  float x_;
+  float y_;
+
+ public:
+  Point(float _x, float _y)
+    : x_(flatbuffers::EndianScalar(_x)), y_(flatbuffers::EndianScalar(_y)) { }
+
+  float x() const { return flatbuffers::EndianScalar(x_); }
+  void mutate_x(float _x) { flatbuffers::WriteScalar(&x_, _x); }
+  float y() const { return flatbuffers::EndianScalar(y_); }
+  void mutate_y(float _y) { flatbuffers::WriteScalar(&y_, _y); }
+};
+STRUCT_END(Point, 8);
+
+struct Layer FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_NAME = 4,
+    VT_POINTS = 6,
+    VT_WEIGHTS = 8
+  };
+  const flatbuffers::String *name() const { return GetPointer<const flatbuffers::String *>(VT_NAME); }
+  flatbuffers::String *mutable_name() { return GetPointer<flatbuffers::String *>(VT_NAME); }
+  bool KeyCompareLessThan(const Layer *o) const { return *name() < *o->name(); }
+  int KeyCompareWithValue(const char *val) const { return strcmp(name()->c_str(), val); }
+  const flatbuffers::String *GetKeyValue() const { return name(); }
+  const flatbuffers::Vector<const Point *> *points() const { return GetPointer<const flatbuffers::Vector<const Point *> *>(VT_POINTS); }
+  flatbuffers::Vector<const Point *> *mutable_points() { return GetPointer<flatbuffers::Vector<const Point *> *>(VT_POINTS); }
+  const flatbuffers::Vector<double> *weights() const { return GetPointer<const flatbuffers::Vector<double> *>(VT_WEIGHTS); }
+  flatbuffers::Vector<double> *mutable_weights() { return GetPointer<flatbuffers::Vector<double> *>(VT_WEIGHTS); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyFieldRequired<flatbuffers::uoffset_t>(verifier, VT_NAME) &&
+           verifier.Verify(name()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_POINTS) &&
+           verifier.Verify(points()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_WEIGHTS) &&
+           verifier.Verify(weights()) &&
+           verifier.EndTable();
+  }
+  static const flatbuffers::TableVerifyDesc *VerifyDescriptor();
+};
+
+struct LayerBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) { fbb_.AddOffset(Layer::VT_NAME, name); }
+  void add_points(flatbuffers::Offset<flatbuffers::Vector<const Point *>> points) { fbb_.AddOffset(Layer::VT_POINTS, points); }
+  void add_weights(flatbuffers::Offset<flatbuffers::Vector<double>> weights) { fbb_.AddOffset(Layer::VT_WEIGHTS, weights); }
+  LayerBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  LayerBuilder &operator=(const LayerBuilder &);
+  flatbuffers::Offset<Layer> Finish() {
+    auto o = flatbuffers::Offset<Layer>(fbb_.EndTable(start_, 3));
+    fbb_.Required(o, Layer::VT_NAME);  // name
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Layer> CreateLayer(flatbuffers::FlatBufferBuilder &_fbb,
+   flatbuffers::Offset<flatbuffers::String> name = 0,
+   flatbuffers::Offset<flatbuffers::Vector<const Point *>> points = 0,
+   flatbuffers::Offset<flatbuffers::Vector<double>> weights = 0) {
+  LayerBuilder builder_(_fbb);
+  builder_.add_weights(weights);
+  builder_.add_points(points);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+inline size_t LayerSizeBound(size_t name_len = 0,
+   size_t points_len = 0,
+   size_t weights_len = 0) {
+  return 6 + 8 * sizeof(flatbuffers::uoffset_t) +
+    flatbuffers::StringSizeBound(name_len) +
+    flatbuffers::VectorSizeBound(points_len, 8, 4) +
+    flatbuffers::VectorSizeBound(weights_len, 8, 8);
+}
+
+inline flatbuffers::Offset<Layer> CreateLayerDirect(flatbuffers::FlatBufferBuilder &_fbb,
+   flatbuffers::Offset<flatbuffers::String> name,
+   flatbuffers::Offset<flatbuffers::Vector<const Point *>> points,
+   flatbuffers::Offset<flatbuffers::Vector<double>> weights) {
+  static const uint8_t _vtable[] = { 10, 0, 32, 0, 8, 0, 16, 0, 24, 0 };
+  auto _table = _fbb.StartDirectTable(32, 8);
+  _fbb.AddDirectOffset(_table, 8, name);
+  _fbb.AddDirectOffset(_table, 16, points);
+  _fbb.AddDirectOffset(_table, 24, weights);
+  return flatbuffers::Offset<Layer>(_fbb.EndDirectTable(_table, _vtable, 4184706983U));
+}
+
+struct Snapshot FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_ID = 4,
+    VT_ORIGIN = 6,
+    VT_LAYERS = 8,
+    VT_TAGS = 10
+  };
+  uint64_t id() const { return GetField<uint64_t>(VT_ID, 0); }
+  bool mutate_id(uint64_t _id) { return SetField(VT_ID, _id); }
+  static void gather_id(const flatbuffers::Vector<flatbuffers::Offset<Snapshot>> &tables, uint64_t *out) { flatbuffers::GatherField<uint64_t>(tables, VT_ID, 0, out); }
+  const Point *origin() const { return GetStruct<const Point *>(VT_ORIGIN); }
+  Point *mutable_origin() { return GetStruct<Point *>(VT_ORIGIN); }
+  const flatbuffers::Vector<flatbuffers::Offset<Layer>> *layers() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Layer>> *>(VT_LAYERS); }
+  flatbuffers::Vector<flatbuffers::Offset<Layer>> *mutable_layers() { return GetPointer<flatbuffers::Vector<flatbuffers::Offset<Layer>> *>(VT_LAYERS); }
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *tags() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TAGS); }
+  flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *mutable_tags() { return GetPointer<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TAGS); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint64_t>(verifier, VT_ID) &&
+           VerifyField<Point>(verifier, VT_ORIGIN) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_LAYERS) &&
+           verifier.Verify(layers()) &&
+           verifier.VerifyVectorOfTables(layers()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_TAGS) &&
+           verifier.Verify(tags()) &&
+           verifier.VerifyVectorOfStrings(tags()) &&
+           verifier.EndTable();
+  }
+  static const flatbuffers::TableVerifyDesc *VerifyDescriptor();
+};
+
+struct SnapshotBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_id(uint64_t id) { fbb_.AddElement<uint64_t>(Snapshot::VT_ID, id, 0); }
+  void add_origin(const Point *origin) { fbb_.AddStruct(Snapshot::VT_ORIGIN, origin); }
+  void add_layers(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Layer>>> layers) { fbb_.AddOffset(Snapshot::VT_LAYERS, layers); }
+  void add_tags(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> tags) { fbb_.AddOffset(Snapshot::VT_TAGS, tags); }
+  SnapshotBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  SnapshotBuilder &operator=(const SnapshotBuilder &);
+  flatbuffers::Offset<Snapshot> Finish() {
+    auto o = flatbuffers::Offset<Snapshot>(fbb_.EndTable(start_, 4));
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Snapshot> CreateSnapshot(flatbuffers::FlatBufferBuilder &_fbb,
+   uint64_t id = 0,
+   const Point *origin = 0,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Layer>>> layers = 0,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> tags = 0) {
+  SnapshotBuilder builder_(_fbb);
+  builder_.add_id(id);
+  builder_.add_tags(tags);
+  builder_.add_layers(layers);
+  builder_.add_origin(origin);
+  return builder_.Finish();
+}
+
+inline size_t SnapshotSizeBound(size_t layers_len = 0,
+   size_t tags_len = 0) {
+  return 35 + 6 * sizeof(flatbuffers::uoffset_t) +
+    flatbuffers::VectorSizeBound(layers_len, sizeof(flatbuffers::uoffset_t), sizeof(flatbuffers::uoffset_t)) +
+    flatbuffers::VectorSizeBound(tags_len, sizeof(flatbuffers::uoffset_t), sizeof(flatbuffers::uoffset_t));
+}
+
+inline flatbuffers::Offset<Snapshot> CreateSnapshotDirect(flatbuffers::FlatBufferBuilder &_fbb,
+   uint64_t id,
+   const Point *origin,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Layer>>> layers,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> tags) {
+  static const uint8_t _vtable[] = { 12, 0, 40, 0, 8, 0, 16, 0, 24, 0, 32, 0 };
+  auto _table = _fbb.StartDirectTable(40, 8);
+  _fbb.AddDirectElement<uint64_t>(_table, 8, id);
+  _fbb.AddDirectStruct(_table, 16, origin);
+  _fbb.AddDirectOffset(_table, 24, layers);
+  _fbb.AddDirectOffset(_table, 32, tags);
+  return flatbuffers::Offset<Snapshot>(_fbb.EndDirectTable(_table, _vtable, 3396496257U));
+}
+
+inline const flatbuffers::TableVerifyDesc *Layer::VerifyDescriptor() {
+  static const flatbuffers::FieldVerifyDesc fields[] = {
+    { VT_NAME, "name", flatbuffers::FieldVerifyDesc::kString, true, 0, nullptr, 0, nullptr, 0, nullptr },
+    { VT_POINTS, "points", flatbuffers::FieldVerifyDesc::kVector, false, sizeof(Point), nullptr, 0, nullptr, 0, nullptr },
+    { VT_WEIGHTS, "weights", flatbuffers::FieldVerifyDesc::kVector, false, sizeof(double), nullptr, 0, nullptr, 0, nullptr }
+  };
+  static const flatbuffers::TableVerifyDesc desc = { fields, 3 };
+  return &desc;
+}
+
+inline const flatbuffers::TableVerifyDesc *Snapshot::VerifyDescriptor() {
+  static const flatbuffers::FieldVerifyDesc fields[] = {
+    { VT_ID, "id", flatbuffers::FieldVerifyDesc::kScalar, false, sizeof(uint64_t), nullptr, 0, nullptr, 0, nullptr },
+    { VT_ORIGIN, "origin", flatbuffers::FieldVerifyDesc::kStruct, false, sizeof(Point), nullptr, 0, nullptr, 0, nullptr },
+    { VT_LAYERS, "layers", flatbuffers::FieldVerifyDesc::kVectorOfTables, false, 0, &Layer::VerifyDescriptor, 0, nullptr, 0, nullptr },
+    { VT_TAGS, "tags", flatbuffers::FieldVerifyDesc::kVectorOfStrings, false, 0, nullptr, 0, nullptr, 0, nullptr }
+  };
+  static const flatbuffers::TableVerifyDesc desc = { fields, 4 };
+  return &desc;
+}
+
+struct CheckedLayer FLATBUFFERS_FINAL_CLASS : private flatbuffers::CheckedTable {
+  CheckedLayer() {}
+  explicit CheckedLayer(const flatbuffers::CheckedTable &table)
+    : flatbuffers::CheckedTable(table) {}
+  using flatbuffers::CheckedTable::IsNull;
+  const flatbuffers::String *name() const { return GetString(Layer::VT_NAME); }
+  const flatbuffers::Vector<const Point *> *points() const { return GetVector<flatbuffers::Vector<const Point *>>(Layer::VT_POINTS, sizeof(Point)); }
+  const flatbuffers::Vector<double> *weights() const { return GetVector<flatbuffers::Vector<double>>(Layer::VT_WEIGHTS, sizeof(double)); }
+};
+
+struct CheckedSnapshot FLATBUFFERS_FINAL_CLASS : private flatbuffers::CheckedTable {
+  CheckedSnapshot() {}
+  explicit CheckedSnapshot(const flatbuffers::CheckedTable &table)
+    : flatbuffers::CheckedTable(table) {}
+  using flatbuffers::CheckedTable::IsNull;
+  uint64_t id() const { return GetField<uint64_t>(Snapshot::VT_ID, 0); }
+  const Point *origin() const { return GetStruct<Point>(Snapshot::VT_ORIGIN); }
+  flatbuffers::CheckedVectorOfTables<CheckedLayer> layers() const;
+  flatbuffers::CheckedVectorOfStrings tags() const { return GetVectorOfStrings(Snapshot::VT_TAGS); }
+};
+
+inline flatbuffers::CheckedVectorOfTables<CheckedLayer> CheckedSnapshot::layers() const {
+  return GetVectorOfTables<CheckedLayer>(Snapshot::VT_LAYERS);
+}
+
+inline const MyGame::Offset64::Snapshot *GetSnapshot(const void *buf) { return flatbuffers::GetRoot<MyGame::Offset64::Snapshot>(buf); }
+
+inline const MyGame::Offset64::Snapshot *GetSizePrefixedSnapshot(const void *buf) { return flatbuffers::GetSizePrefixedRoot<MyGame::Offset64::Snapshot>(buf); }
+
+inline CheckedSnapshot GetCheckedSnapshot(const flatbuffers::CheckedBuffer &buf) { return CheckedSnapshot(buf.GetRootTable()); }
+
+inline Snapshot *GetMutableSnapshot(void *buf) { return flatbuffers::GetMutableRoot<Snapshot>(buf); }
+
+inline bool VerifySnapshotBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifyBuffer<MyGame::Offset64::Snapshot>(); }
+
+inline bool VerifySizePrefixedSnapshotBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifySizePrefixedBuffer<MyGame::Offset64::Snapshot>(); }
+
+inline const char *SnapshotIdentifier() { return "SNAP"; }
+
+inline bool SnapshotBufferHasIdentifier(const void *buf) { return flatbuffers::BufferHasIdentifier(buf, SnapshotIdentifier()); }
+
+inline void FinishSnapshotBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<MyGame::Offset64::Snapshot> root) { fbb.Finish(root, SnapshotIdentifier()); }
+
+inline void FinishSizePrefixedSnapshotBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<MyGame::Offset64::Snapshot> root) { fbb.FinishSizePrefixed(root, SnapshotIdentifier()); }
+
+}  // namespace Offset64
+}  // namespace MyGame
+
+#endif  // FLATBUFFERS_GENERATED_OFFSET64TEST_MYGAME_OFFSET64_H_
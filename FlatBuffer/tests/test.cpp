@@ -16,11 +16,18 @@
 
 #define FLATBUFFERS_DEBUG_VERIFICATION_FAILURE 1
 
+#ifdef FLATBUFFERS_64BIT_OFFSETS
+  #error "These tests use 32bit offsets, see offset64_test.cpp instead."
+#endif
+
 #include "flatbuffers/flatbuffers.h"
 #include "flatbuffers/idl.h"
+#include "flatbuffers/builder_pool.h"
+#include "flatbuffers/parallel_verifier.h"
 #include "flatbuffers/util.h"
 
 #include "monster_test_generated.h"
+#include "key_lookup_test_generated.h"
 #include "namespace_test/namespace_test1_generated.h"
 #include "namespace_test/namespace_test2_generated.h"
 
@@ -783,6 +790,8 @@ void ErrorTest() {
   TestError("struct X (force_align: 7) { Y:int; }", "force_align");
   TestError("{}", "no root");
   TestError("table X { Y:byte; } root_type X; { Y:1 } { Y:1 }", "one json");
+  TestError("table X (offset64) { Y:int; } root_type X; { Y:1 }",
+            "64bit offsets");
   TestError("root_type X;", "unknown root");
   TestError("struct X { Y:int; } root_type X;", "a table");
   TestError("union X { Y }", "referenced");
@@ -790,6 +799,17 @@ void ErrorTest() {
   TestError("table X { Y:[int]; YLength:int; }", "clash");
   TestError("table X { Y:string = 1; }", "scalar");
   TestError("table X { Y:byte; } root_type X; { Y:1, Y:2 }", "more than once");
+  TestError("table X { Y:[X] (key_layout: \"tree\"); }", "eytzinger");
+  TestError("table X { Y:[int] (key_layout: \"eytzinger\"); }",
+            "vector of tables");
+  TestError("table X { Y:int; Z:[X] (key_layout: \"eytzinger\"); }",
+            "key field");
+  TestError("table X { Y:int (hash_index); }", "vector of tables");
+  TestError("table X { Y:string (key); Z:[X] (hash_index); }", "needs an id");
+  TestError("table X { Y:int (key, id: 0); Z:[X] (hash_index, id: 1); }",
+            "string key");
+  TestError("table X { Y:string (key); Z:[X] (hash_index, id: 1, "
+            "key_layout: \"eytzinger\"); }", "combined");
 }
 
 // Additional parser testing not covered elsewhere.
@@ -855,6 +875,1314 @@ void UnknownFieldsTest() {
   TEST_EQ(jsongen == "{str: \"test\",i: 10}", true);
 }
 
+// Tables with the same layout must share a vtable, no matter how many
+// different layouts were written in between.
+void VTableDedupTest() {
+  flatbuffers::FlatBufferBuilder builder;
+  const int kShapes = 100;
+  std::vector<flatbuffers::uoffset_t> tables;
+  for (int pass = 0; pass < 2; pass++) {
+    for (int shape = 0; shape < kShapes; shape++) {
+      auto start = builder.StartTable();
+      // Each shape sets a different subset of 8 fields.
+      for (int field = 0; field < 8; field++) {
+        if ((shape + 1) & (1 << field))
+          builder.AddElement<int32_t>(flatbuffers::FieldIndexToOffset(
+            static_cast<flatbuffers::voffset_t>(field)), shape, 0);
+      }
+      tables.push_back(builder.EndTable(start, 8));
+    }
+  }
+  auto vtable_of = [&](flatbuffers::uoffset_t table) {
+    auto t = reinterpret_cast<flatbuffers::Table *>(
+               builder.GetCurrentBufferPointer() + builder.GetSize() - table);
+    return t->GetVTable();
+  };
+  for (int shape = 0; shape < kShapes; shape++) {
+    TEST_EQ(vtable_of(tables[shape]) == vtable_of(tables[shape + kShapes]),
+            true);
+    if (shape)
+      TEST_EQ(vtable_of(tables[shape]) == vtable_of(tables[shape - 1]), false);
+  }
+
+  // Building the same data again after Clear() must give identical bytes.
+  std::string first(reinterpret_cast<const char *>(
+                      builder.GetCurrentBufferPointer()), builder.GetSize());
+  builder.Clear();
+  for (int pass = 0; pass < 2; pass++) {
+    for (int shape = 0; shape < kShapes; shape++) {
+      auto start = builder.StartTable();
+      for (int field = 0; field < 8; field++) {
+        if ((shape + 1) & (1 << field))
+          builder.AddElement<int32_t>(flatbuffers::FieldIndexToOffset(
+            static_cast<flatbuffers::voffset_t>(field)), shape, 0);
+      }
+      builder.EndTable(start, 8);
+    }
+  }
+  std::string second(reinterpret_cast<const char *>(
+                       builder.GetCurrentBufferPointer()), builder.GetSize());
+  TEST_EQ(first == second, true);
+}
+
+// Builders using the stock allocators must produce the same bytes as the
+// default one, while avoiding copies (arena) or heap traffic (pooled).
+void AllocatorTest() {
+  auto build = [](flatbuffers::FlatBufferBuilder &builder) {
+    std::vector<uint8_t> ints(40000);
+    for (size_t i = 0; i < ints.size(); i++)
+      ints[i] = static_cast<uint8_t>(i);
+    auto vec = builder.CreateVector(ints);
+    auto name = builder.CreateString("MyMonster");
+    builder.Finish(CreateMonster(builder, nullptr, 0, 0, name, vec));
+    return std::string(reinterpret_cast<const char *>(
+                         builder.GetBufferPointer()), builder.GetSize());
+  };
+
+  flatbuffers::FlatBufferBuilder reference;
+  auto expected = build(reference);
+
+  // Starting small forces many growth steps, all done in place.
+  std::vector<uint8_t> region(1024 * 1024);
+  flatbuffers::arena_allocator arena(region.data(), region.size());
+  {
+    flatbuffers::FlatBufferBuilder builder(64, &arena);
+    TEST_EQ(build(builder) == expected, true);
+    auto p = builder.GetBufferPointer();
+    TEST_EQ(p >= region.data() && p < region.data() + region.size(), true);
+    TEST_EQ(arena.used() < 2 * expected.size() + 1024, true);
+  }
+  arena.reset();
+  TEST_EQ(arena.used(), 0u);
+
+  // An arena that is too small falls back to the heap.
+  flatbuffers::arena_allocator small_arena(region.data(), 256);
+  {
+    flatbuffers::FlatBufferBuilder builder(64, &small_arena);
+    TEST_EQ(build(builder) == expected, true);
+  }
+
+  flatbuffers::pooled_allocator pool;
+  {
+    flatbuffers::FlatBufferBuilder builder(1024, &pool);
+    TEST_EQ(build(builder) == expected, true);
+    auto released = builder.ReleaseBufferPointer();
+  }
+  auto cached = pool.cached_bytes();
+  TEST_EQ(cached > 0, true);
+  {
+    // The same sequence of sizes must be served entirely from the pool,
+    // otherwise it would hold on to more memory afterwards.
+    flatbuffers::FlatBufferBuilder builder(1024, &pool);
+    TEST_EQ(build(builder) == expected, true);
+    auto released = builder.ReleaseBufferPointer();
+  }
+  TEST_EQ(pool.cached_bytes(), cached);
+}
+
+// Builders from a pool must be reset when returned, and once the pool has
+// warmed up, building and releasing buffers must be served from its cache.
+void BuilderPoolTest() {
+  flatbuffers::BuilderPool pool;
+  auto build = [&](int i) {
+    auto builder = pool.Acquire();
+    TEST_EQ(builder->GetSize(), 0u);
+    std::vector<uint8_t> inventory(1000 * (i % 4 + 1));
+    auto vec = builder->CreateVector(inventory);
+    auto name = builder->CreateString("MyMonster");
+    builder->Finish(CreateMonster(*builder, nullptr, 0, 0, name, vec));
+    auto buf = builder->ReleaseBufferPointer();
+    TEST_EQ(GetMonster(buf.get())->inventory()->size(), inventory.size());
+  };
+  for (int i = 0; i < 8; i++) build(i);
+  TEST_EQ(pool.idle(), 1u);
+  auto cached = pool.cached_bytes();
+  for (int i = 0; i < 8; i++) build(i);
+  TEST_EQ(pool.cached_bytes(), cached);
+
+  // Concurrent leases get different builders.
+  {
+    auto a = pool.Acquire();
+    auto b = pool.Acquire();
+    TEST_EQ(a.get() != b.get(), true);
+  }
+  TEST_EQ(pool.idle(), 2u);
+}
+
+// A buffer built in segments must have the same contents as one built
+// contiguously, and objects must not be split between segments.
+void SegmentedBuildTest() {
+  auto build = [](flatbuffers::FlatBufferBuilder &builder) {
+    std::vector<flatbuffers::Offset<Monster>> monsters;
+    for (int i = 0; i < 200; i++) {
+      auto name = builder.CreateString("Monster" + flatbuffers::NumToString(i));
+      std::vector<uint8_t> inventory(i * 3 + 1, static_cast<uint8_t>(i));
+      auto inv = builder.CreateVector(inventory);
+      monsters.push_back(CreateMonster(builder, nullptr, 0,
+                                       static_cast<int16_t>(i), name, inv));
+    }
+    // One object much larger than a segment.
+    std::vector<uint8_t> big(10000, 42);
+    auto inv = builder.CreateVector(big);
+    auto vec = builder.CreateVector(monsters);
+    auto name = builder.CreateString("Root");
+    MonsterBuilder mb(builder);
+    mb.add_name(name);
+    mb.add_inventory(inv);
+    mb.add_testarrayoftables(vec);
+    builder.Finish(mb.Finish(), MonsterIdentifier());
+  };
+
+  flatbuffers::FlatBufferBuilder reference;
+  build(reference);
+  std::string expected(reinterpret_cast<const char *>(
+                         reference.GetBufferPointer()), reference.GetSize());
+  TEST_EQ(reference.GetBufferSegments().size(), 1u);
+
+  flatbuffers::FlatBufferBuilder builder(256);
+  builder.SetSegmentSize(512);
+  build(builder);
+  auto segments = builder.GetBufferSegments();
+  TEST_EQ(segments.size() > 10, true);
+  size_t total = 0;
+  for (auto it = segments.begin(); it != segments.end(); ++it) {
+    // Every segment is aligned as if the buffer were contiguous.
+    TEST_EQ((reinterpret_cast<size_t>(it->data) + builder.GetSize() - total)
+            % 8, 0u);
+    TEST_EQ(memcmp(it->data, expected.data() + total, it->size), 0);
+    total += it->size;
+  }
+  TEST_EQ(total, expected.size());
+  std::string flat(builder.GetSize(), 0);
+  builder.CopyBufferTo(reinterpret_cast<uint8_t *>(&flat[0]));
+  TEST_EQ(flat == expected, true);
+  flatbuffers::Verifier verifier(
+    reinterpret_cast<const uint8_t *>(flat.data()), flat.size());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+
+  // The builder can be reused, and stays segmented.
+  builder.Clear();
+  build(builder);
+  TEST_EQ(builder.GetBufferSegments().size() > 1, true);
+  std::string flat2(builder.GetSize(), 0);
+  builder.CopyBufferTo(reinterpret_cast<uint8_t *>(&flat2[0]));
+  TEST_EQ(flat2 == expected, true);
+}
+
+// Shared strings and vtables are found again after a segment boundary, even
+// when their bytes ended up in an older segment.
+void SegmentedSharingTest() {
+  {
+    flatbuffers::FlatBufferBuilder builder(16);
+    builder.SetSegmentSize(64);
+    auto a = builder.CreateSharedString("abcdefg");
+    auto b = builder.CreateSharedString("hijklmn");
+    TEST_EQ(builder.CreateSharedString("abcdefg").o, a.o);
+    TEST_EQ(builder.CreateSharedString("hijklmn").o, b.o);
+    builder.Finish(b);
+    TEST_EQ(builder.GetBufferSegments().size() > 1, true);
+  }
+
+  auto build = [](flatbuffers::FlatBufferBuilder &builder) {
+    const char *names[] = { "abcdefg", "hijklmn", "o" };
+    std::vector<flatbuffers::Offset<Monster>> monsters;
+    for (int i = 0; i < 50; i++) {
+      auto name = builder.CreateSharedString(names[i % 3]);
+      auto stat = CreateStat(builder, builder.CreateSharedString(names[i % 2]),
+                             i, static_cast<uint16_t>(i));
+      monsters.push_back(CreateMonster(builder, nullptr, 0,
+                                       static_cast<int16_t>(i), name,
+                                       0, Color_Blue, Any_NONE, 0, 0, 0, 0, 0, 0,
+                                       stat));
+    }
+    auto vec = builder.CreateVector(monsters);
+    auto name = builder.CreateSharedString(names[2]);
+    MonsterBuilder mb(builder);
+    mb.add_name(name);
+    mb.add_testarrayoftables(vec);
+    builder.Finish(mb.Finish(), MonsterIdentifier());
+  };
+
+  flatbuffers::FlatBufferBuilder reference;
+  build(reference);
+
+  for (size_t segment_size = 64; segment_size <= 256; segment_size += 8) {
+    flatbuffers::FlatBufferBuilder builder(16);
+    builder.SetSegmentSize(segment_size);
+    build(builder);
+    TEST_EQ(builder.GetBufferSegments().size() > 1, true);
+    TEST_EQ(builder.GetSize(), reference.GetSize());
+    std::string flat(builder.GetSize(), 0);
+    builder.CopyBufferTo(reinterpret_cast<uint8_t *>(&flat[0]));
+    TEST_EQ(memcmp(flat.data(), reference.GetBufferPointer(), flat.size()),
+            0);
+    flatbuffers::Verifier verifier(
+      reinterpret_cast<const uint8_t *>(flat.data()), flat.size());
+    TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  }
+}
+
+// The generated size bounds must cover what is actually written, such that
+// reserving them up front avoids any reallocation.
+void SizeBoundTest() {
+  flatbuffers::FlatBufferBuilder builder;
+  std::string name = "MyMonster";
+  std::vector<uint8_t> inventory(5000);
+  Test tests[] = { Test(10, 20), Test(30, 40) };
+  std::vector<std::string> strings(3, "str");
+  builder.Reserve(MonsterSizeBound(name.size(), inventory.size(), 2,
+                                   strings.size()) +
+                  strings.size() * flatbuffers::StringSizeBound(3) +
+                  flatbuffers::FinishSizeBound());
+  auto end = builder.GetCurrentBufferPointer() + builder.GetSize();
+  std::vector<flatbuffers::Offset<flatbuffers::String>> string_offsets;
+  for (auto it = strings.begin(); it != strings.end(); ++it)
+    string_offsets.push_back(builder.CreateString(*it));
+  auto strs = builder.CreateVector(string_offsets);
+  auto n = builder.CreateString(name);
+  auto inv = builder.CreateVector(inventory);
+  auto t4 = builder.CreateVectorOfStructs(tests, 2);
+  Vec3 vec(1, 2, 3, 0, Color_Red, Test(10, 20));
+  builder.Finish(CreateMonster(builder, &vec, 150, 80, n, inv, Color_Blue,
+                               Any_NONE, 0, t4, strs));
+  TEST_EQ(builder.GetCurrentBufferPointer() + builder.GetSize() == end, true);
+
+  // The bound for a table is exact when all fields have maximum padding,
+  // so check it is never too small for tables of various shapes.
+  for (int i = 0; i < 16; i++) {
+    auto before = builder.GetSize();
+    builder.PushElement<uint8_t>(1);  // Misalign.
+    auto id = builder.CreateString("id");
+    auto mid = builder.GetSize();
+    StatBuilder sb(builder);
+    if (i & 1) sb.add_id(id);
+    if (i & 2) sb.add_val(i);
+    if (i & 4) sb.add_count(static_cast<uint16_t>(i));
+    sb.Finish();
+    TEST_EQ(builder.GetSize() - mid <= StatSizeBound(), true);
+    TEST_EQ(mid - before - 1 <= flatbuffers::StringSizeBound(2), true);
+  }
+}
+
+// Shared strings must be stored once per distinct contents (including any
+// embedded zeroes), whether or not their hash was computed up front.
+void SharedStringTest() {
+  static const flatbuffers::PrehashedString dictionary[] = {
+    flatbuffers::PrehashedString("host"),
+    flatbuffers::PrehashedString("region"),
+    flatbuffers::PrehashedString("a\0b", 3),
+  };
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<flatbuffers::uoffset_t> offsets;
+  for (int i = 0; i < 1000; i++) {
+    auto s = "tag" + flatbuffers::NumToString(i % 100);
+    offsets.push_back(builder.CreateSharedString(s).o);
+  }
+  for (int i = 0; i < 1000; i++) {
+    TEST_EQ(offsets[i], offsets[i % 100]);
+    if (i && i < 100) TEST_EQ(offsets[i] != offsets[i - 1], true);
+  }
+  auto host = builder.CreateSharedString("host");
+  TEST_EQ(builder.CreateSharedString(dictionary[0]).o, host.o);
+  auto region = builder.CreateSharedString(dictionary[1]);
+  TEST_EQ(builder.CreateSharedString(std::string("region")).o, region.o);
+  auto ab = builder.CreateSharedString(dictionary[2]);
+  auto ac = builder.CreateSharedString("a\0c", 3);
+  TEST_EQ(ab.o != ac.o, true);
+  TEST_EQ(builder.CreateSharedString("a\0b", 3).o, ab.o);
+
+  // Nothing is shared with what was built before Clear().
+  builder.Clear();
+  auto first = builder.CreateSharedString("host");
+  TEST_EQ(builder.CreateSharedString(dictionary[0]).o, first.o);
+  TEST_EQ(builder.CreateSharedString("tag1").o != first.o, true);
+}
+
+// Sorting tables by extracted keys must give the same order as comparing
+// the tables themselves.
+void SortedTablesTest() {
+  std::mt19937 rng(42);
+  flatbuffers::FlatBufferBuilder builder;
+
+  // String keys, many sharing their first 8 bytes.
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  for (int i = 0; i < 500; i++) {
+    auto name = (rng() % 2 ? "LongPrefix" : "") +
+                flatbuffers::NumToString(rng() % 1000);
+    monsters.push_back(CreateMonster(builder, nullptr, 0, 0,
+                                     builder.CreateString(name)));
+  }
+  auto mvec = builder.CreateVectorOfSortedTables(&monsters);
+
+  // Scalar keys, including negative ones.
+  std::vector<flatbuffers::Offset<reflection::EnumVal>> vals;
+  for (int i = 0; i < 500; i++) {
+    auto value = static_cast<int64_t>(rng()) - (1LL << 31);
+    if (i % 3 == 0) value *= 1000000;
+    vals.push_back(reflection::CreateEnumVal(builder, builder.CreateString("v"),
+                                             value));
+  }
+  auto vvec = builder.CreateVectorOfSortedTables(&vals);
+  builder.Finish(mvec);
+
+  auto end = builder.GetBufferPointer() + builder.GetSize();
+  auto monster_vec = reinterpret_cast<
+    const flatbuffers::Vector<flatbuffers::Offset<Monster>> *>(end - mvec.o);
+  for (flatbuffers::uoffset_t i = 1; i < monster_vec->size(); i++) {
+    TEST_EQ(monster_vec->Get(i)->KeyCompareLessThan(monster_vec->Get(i - 1)),
+            false);
+  }
+  auto name = monster_vec->Get(250)->name()->c_str();
+  TEST_NOTNULL(monster_vec->LookupByKey(name));
+  auto val_vec = reinterpret_cast<
+    const flatbuffers::Vector<flatbuffers::Offset<reflection::EnumVal>> *>(
+      end - vvec.o);
+  for (flatbuffers::uoffset_t i = 1; i < val_vec->size(); i++) {
+    TEST_EQ(val_vec->Get(i)->KeyCompareLessThan(val_vec->Get(i - 1)), false);
+  }
+
+  TEST_EQ(flatbuffers::SortableKey(-1.5f) < flatbuffers::SortableKey(-0.5),
+          true);
+  TEST_EQ(flatbuffers::SortableKey(-0.0), flatbuffers::SortableKey(0.0));
+  TEST_EQ(flatbuffers::SortableKey(0.0) < flatbuffers::SortableKey(1e-300),
+          true);
+  TEST_EQ(flatbuffers::SortableKey(int8_t(-128)) <
+          flatbuffers::SortableKey(int8_t(127)), true);
+}
+
+// Objects built in separate builders must be usable after splicing them
+// into another one.
+void SpliceTest() {
+  flatbuffers::FlatBufferBuilder parent;
+  parent.CreateString("unrelated");
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  flatbuffers::FlatBufferBuilder child;
+  for (int part = 0; part < 4; part++) {
+    child.Clear();
+    // Give the children different alignment needs.
+    if (part % 2) child.PushElement<double>(0);
+    std::vector<flatbuffers::Offset<Monster>> part_monsters;
+    for (int i = 0; i < 10; i++) {
+      auto name = child.CreateSharedString("M" + flatbuffers::NumToString(i));
+      uint8_t inv[] = { static_cast<uint8_t>(part), static_cast<uint8_t>(i) };
+      part_monsters.push_back(CreateMonster(child, nullptr, 0,
+                                            static_cast<int16_t>(part * 10 + i),
+                                            name, child.CreateVector(inv, 2)));
+    }
+    auto base = parent.Splice(child);
+    for (auto it = part_monsters.begin(); it != part_monsters.end(); ++it)
+      monsters.push_back(flatbuffers::Offset<Monster>(it->o + base));
+  }
+  // Strings and vtables of the children are reused.
+  auto size = parent.GetSize();
+  auto name = parent.CreateSharedString("M3");
+  TEST_EQ(parent.GetSize(), size);
+  monsters.push_back(CreateMonster(parent, nullptr, 0, 40, name));
+  auto vec = parent.CreateVector(monsters);
+  auto root_name = parent.CreateString("Root");
+  parent.Finish(CreateMonster(parent, nullptr, 0, 0, root_name, 0,
+                              Color_Blue, Any_NONE, 0, 0, 0, vec),
+                MonsterIdentifier());
+
+  flatbuffers::Verifier verifier(parent.GetBufferPointer(),
+                                 parent.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  auto tables = GetMonster(parent.GetBufferPointer())->testarrayoftables();
+  TEST_EQ(tables->size(), 41u);
+  for (flatbuffers::uoffset_t i = 0; i < 40; i++) {
+    auto m = tables->Get(i);
+    TEST_EQ(m->hp(), static_cast<int16_t>(i));
+    TEST_EQ_STR(m->name()->c_str(),
+                ("M" + flatbuffers::NumToString(i % 10)).c_str());
+    TEST_EQ(m->inventory()->Get(0), i / 10);
+    TEST_EQ(m->inventory()->Get(1), i % 10);
+  }
+  TEST_EQ_STR(tables->Get(40)->name()->c_str(), "M3");
+}
+
+// Tables written with the generated direct writers must read back the same
+// as ones written field by field, and share their vtables.
+void DirectTableTest() {
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<flatbuffers::Offset<Stat>> stats;
+  for (int i = 0; i < 10; i++) {
+    auto id = builder.CreateString("stat" + flatbuffers::NumToString(i));
+    builder.PushElement<uint8_t>(0);  // Misalign.
+    if (i % 2)
+      stats.push_back(CreateStat(builder, id, i * 1000000000LL,
+                                 static_cast<uint16_t>(i)));
+    else
+      stats.push_back(CreateStatDirect(builder, id, i * 1000000000LL,
+                                       static_cast<uint16_t>(i)));
+  }
+  // Only the table itself (and padding) is added, the vtable is reused.
+  auto id = builder.CreateString("again");
+  auto size = builder.GetSize();
+  auto again = CreateStatDirect(builder, id, 1, 2);
+  TEST_EQ(builder.GetSize() - size < 24 + 8, true);
+
+  auto enum_table = CreateTestSimpleTableWithEnumDirect(builder, Color_Red);
+  Vec3 vec(1, 2, 3, 4, Color_Green, Test(5, 6));
+  auto name = builder.CreateString("Direct");
+  builder.Finish(CreateMonster(builder, &vec, 150, 80, name, 0, Color_Blue,
+                               Any_TestSimpleTableWithEnum,
+                               enum_table.Union(), 0, 0, 0, 0, 0, again));
+
+  flatbuffers::Verifier verifier(builder.GetBufferPointer(),
+                                 builder.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  auto monster = GetMonster(builder.GetBufferPointer());
+  TEST_EQ(monster->testempty()->val(), 1);
+  TEST_EQ(monster->testempty()->count(), 2);
+  TEST_EQ_STR(monster->testempty()->id()->c_str(), "again");
+  auto union_table = reinterpret_cast<const TestSimpleTableWithEnum *>(
+                       monster->test());
+  TEST_EQ(union_table->color(), Color_Red);
+
+  auto end = builder.GetBufferPointer() + builder.GetSize();
+  for (int i = 0; i < 10; i++) {
+    auto stat = reinterpret_cast<const Stat *>(end - stats[i].o);
+    TEST_EQ(stat->val(), i * 1000000000LL);
+    TEST_EQ(stat->count(), i);
+    TEST_EQ_STR(stat->id()->c_str(),
+                ("stat" + flatbuffers::NumToString(i)).c_str());
+  }
+}
+
+void SizePrefixedTest() {
+  // Write a few buffers back to back, as into a log.
+  std::string stream;
+  flatbuffers::FlatBufferBuilder builder;
+  for (int i = 0; i < 5; i++) {
+    builder.Clear();
+    auto name = builder.CreateString(std::string(i * 3 + 1, 'x'));
+    FinishSizePrefixedMonsterBuffer(builder,
+        CreateMonster(builder, nullptr, 0, static_cast<int16_t>(i), name));
+    auto buf = builder.GetBufferPointer();
+    TEST_EQ(flatbuffers::GetPrefixedSize(buf) + sizeof(flatbuffers::uoffset_t),
+            builder.GetSize());
+    TEST_EQ(flatbuffers::BufferHasIdentifier(buf, MonsterIdentifier(), true),
+            true);
+    TEST_EQ(GetSizePrefixedMonster(buf)->hp(), i);
+    flatbuffers::Verifier verifier(buf, builder.GetSize());
+    TEST_EQ(VerifySizePrefixedMonsterBuffer(verifier), true);
+    stream.append(reinterpret_cast<const char *>(buf), builder.GetSize());
+  }
+
+  // Read it back as it would arrive from a pipe, in two parts.
+  std::string data = stream.substr(0, stream.size() / 2);
+  int count = 0;
+  for (int part = 0; part < 2; part++) {
+    flatbuffers::SizePrefixedBufferReader reader(data.data(), data.size());
+    const uint8_t *buf;
+    size_t len;
+    while (reader.Next(&buf, &len)) {
+      flatbuffers::Verifier verifier(buf, len);
+      TEST_EQ(VerifyMonsterBuffer(verifier), true);
+      TEST_EQ(GetMonster(buf)->hp(), count);
+      count++;
+    }
+    data = data.substr(reader.position()) +
+           stream.substr(stream.size() / 2);
+  }
+  TEST_EQ(count, 5);
+}
+
+void BuilderStatsTest() {
+  flatbuffers::FlatBufferBuilder builder(64);
+  auto name = builder.CreateSharedString("M");
+  TEST_EQ(builder.CreateSharedString("M").o, name.o);
+  std::vector<uint8_t> inv(200, 1);
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  for (int i = 0; i < 2; i++) {
+    monsters.push_back(CreateMonster(builder, nullptr, 0,
+                                     static_cast<int16_t>(i), name,
+                                     builder.CreateVector(inv)));
+  }
+  auto vec = builder.CreateVector(monsters);
+  FinishMonsterBuffer(builder, CreateMonster(builder, nullptr, 0, 0, name, 0,
+                                             Color_Blue, Any_NONE, 0, 0, 0,
+                                             vec));
+  auto stats = builder.GetStats();
+  TEST_EQ(stats.buffer_size, builder.GetSize());
+  #ifdef FLATBUFFERS_BUILDER_STATS
+    TEST_EQ(stats.shared_strings_written, 1u);
+    TEST_EQ(stats.shared_strings_reused, 1u);
+    // The two inner monsters share a vtable, the root has its own.
+    TEST_EQ(stats.vtables_written, 2u);
+    TEST_EQ(stats.vtables_reused, 1u);
+    TEST_EQ(stats.reallocations > 0, true);
+    TEST_EQ(stats.bytes_moved > 0, true);
+    TEST_EQ(stats.padding_bytes > 0, true);
+  #endif
+
+  builder.Clear();
+  stats = builder.GetStats();
+  TEST_EQ(stats.reallocations, 0u);
+  TEST_EQ(stats.vtables_written, 0u);
+  TEST_EQ(stats.buffer_size, 0u);
+}
+
+void GeneratedVectorTest() {
+  flatbuffers::FlatBufferBuilder builder;
+  // Element functions may build vectors this way themselves.
+  auto monsters = builder.CreateVectorOfSortedTables(20, [&](size_t i) {
+    auto name = builder.CreateString("M" + flatbuffers::NumToString(19 - i));
+    auto strings = builder.CreateVectorOfSharedStrings(3, [&](size_t j) {
+      return j == 2 ? "last" : "other";
+    });
+    return CreateMonster(builder, nullptr, 0, static_cast<int16_t>(i), name,
+                         0, Color_Blue, Any_NONE, 0, 0, strings);
+  });
+  auto names = builder.CreateVectorOfStrings(2, [](size_t i) {
+    return flatbuffers::NumToString(i);
+  });
+  FinishMonsterBuffer(builder, CreateMonster(builder, nullptr, 0, 0,
+                                             builder.CreateString("Root"), 0,
+                                             Color_Blue, Any_NONE, 0, 0,
+                                             names, monsters));
+
+  flatbuffers::Verifier verifier(builder.GetBufferPointer(),
+                                 builder.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  auto root = GetMonster(builder.GetBufferPointer());
+  TEST_EQ_STR(root->testarrayofstring()->Get(1)->c_str(), "1");
+  auto tables = root->testarrayoftables();
+  TEST_EQ(tables->size(), 20u);
+  for (flatbuffers::uoffset_t i = 0; i < tables->size(); i++) {
+    auto m = tables->Get(i);
+    if (i) TEST_EQ(m->KeyCompareLessThan(tables->Get(i - 1)), false);
+    auto strings = m->testarrayofstring();
+    TEST_EQ(strings->size(), 3u);
+    TEST_EQ_STR(strings->Get(2)->c_str(), "last");
+    TEST_EQ(strings->Get(0), strings->Get(1));  // Shared.
+  }
+  TEST_EQ(tables->LookupByKey("M7")->hp(), 12);
+}
+
+void SharedTableTest() {
+  flatbuffers::FlatBufferBuilder builder;
+  auto red = CreateSharedTestSimpleTableWithEnum(builder, Color_Red);
+  // Neither other data in between nor a different vtable get in the way.
+  builder.CreateString("unrelated");
+  CreateMonster(builder, nullptr, 0, 1, builder.CreateString("M"));
+  auto green = CreateSharedTestSimpleTableWithEnum(builder, Color_Green);
+  TEST_EQ(green.o != red.o, true);
+  auto size = builder.GetSize();
+  TEST_EQ(CreateSharedTestSimpleTableWithEnum(builder, Color_Red).o, red.o);
+  TEST_EQ(CreateSharedTestSimpleTableWithEnum(builder, Color_Green).o,
+          green.o);
+  TEST_EQ(builder.GetSize(), size);
+  // Tables made with the regular functions are never shared.
+  auto unshared = CreateTestSimpleTableWithEnum(builder, Color_Red);
+  TEST_EQ(unshared.o != red.o, true);
+  TEST_EQ(CreateSharedTestSimpleTableWithEnum(builder, Color_Red).o, red.o);
+
+  // Shared tables of a spliced builder are reused too.
+  flatbuffers::FlatBufferBuilder child;
+  child.CreateString("padding");
+  auto blue = CreateSharedTestSimpleTableWithEnum(child, Color_Blue);
+  auto base = builder.Splice(child);
+  TEST_EQ(CreateSharedTestSimpleTableWithEnum(builder, Color_Blue).o,
+          base + blue.o);
+
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  for (int i = 0; i < 4; i++) {
+    auto test = CreateSharedTestSimpleTableWithEnum(builder,
+                                                    i % 2 ? Color_Red
+                                                          : Color_Blue);
+    auto name = builder.CreateSharedString("M");
+    monsters.push_back(CreateMonster(builder, nullptr, 0,
+                                     static_cast<int16_t>(i), name, 0,
+                                     Color_Blue, Any_TestSimpleTableWithEnum,
+                                     test.Union()));
+  }
+  auto vec = builder.CreateVector(monsters);
+  FinishMonsterBuffer(builder, CreateMonster(builder, nullptr, 0, 0,
+                                             builder.CreateString("Root"), 0,
+                                             Color_Blue, Any_NONE, 0, 0, 0,
+                                             vec));
+  flatbuffers::Verifier verifier(builder.GetBufferPointer(),
+                                 builder.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  auto tables = GetMonster(builder.GetBufferPointer())->testarrayoftables();
+  for (flatbuffers::uoffset_t i = 0; i < tables->size(); i++) {
+    auto test = reinterpret_cast<const TestSimpleTableWithEnum *>(
+                  tables->Get(i)->test());
+    TEST_EQ(test->color(), i % 2 ? Color_Red : Color_Blue);
+    TEST_EQ(test, tables->Get(i % 2)->test());
+  }
+
+  // A duplicate that started a new segment is removed from that segment
+  // only, together with its padding. Leaves with a 64-bit field need 4 bytes
+  // of padding after half of the strings.
+  flatbuffers::FlatBufferBuilder segmented(64);
+  segmented.SetSegmentSize(64);
+  auto leaf = [&](int64_t value) {
+    segmented.StartSharedTable(sizeof(int64_t));
+    auto start = segmented.StartTable();
+    segmented.AddElement<int64_t>(4, value, 0);
+    return flatbuffers::Offset<flatbuffers::Table>(
+      segmented.EndSharedTable(start, 1));
+  };
+  std::vector<flatbuffers::Offset<flatbuffers::Table>> leaves;
+  for (int i = 0; i < 40; i++) {
+    segmented.CreateString(std::string(static_cast<size_t>(i % 7), 's'));
+    auto before = segmented.GetSize();
+    leaves.push_back(leaf(i % 2 + 1));
+    if (i >= 2) {
+      TEST_EQ(leaves.back().o, leaves[i % 2].o);
+      TEST_EQ(segmented.GetSize(), before);
+    }
+  }
+  #ifdef FLATBUFFERS_BUILDER_STATS
+    // Only the two leaves that were kept count towards the vtable stats.
+    auto stats = segmented.GetStats();
+    TEST_EQ(stats.shared_tables_reused, 38u);
+    TEST_EQ(stats.vtables_written, 1u);
+    TEST_EQ(stats.vtables_reused, 1u);
+  #endif
+  segmented.Finish(segmented.CreateVector(leaves));
+  TEST_EQ(segmented.GetBufferSegments().size() > 1, true);
+  std::vector<uint8_t> flat(segmented.GetSize());
+  segmented.CopyBufferTo(flat.data());
+  auto root = flatbuffers::GetRoot<
+    flatbuffers::Vector<flatbuffers::Offset<flatbuffers::Table>>>(
+      flat.data());
+  for (flatbuffers::uoffset_t i = 0; i < root->size(); i++) {
+    TEST_EQ(root->Get(i)->GetField<int64_t>(4, 0), i % 2 + 1);
+  }
+}
+
+void SharedVerifyTest() {
+  // Every level refers to the one below twice, so a tree walk would visit
+  // 2^40 tables.
+  flatbuffers::FlatBufferBuilder builder;
+  auto name = builder.CreateSharedString("M");
+  auto strings = builder.CreateVectorOfStrings(2, [](size_t) { return "s"; });
+  auto level = CreateMonster(builder, nullptr, 0, 0, name, 0, Color_Blue,
+                             Any_NONE, 0, 0, strings);
+  for (int i = 1; i <= 40; i++) {
+    flatbuffers::Offset<Monster> below[] = { level, level };
+    auto vec = builder.CreateVector(below, 2);
+    level = CreateMonster(builder, nullptr, 0, static_cast<int16_t>(i), name,
+                          0, Color_Blue, Any_Monster, level.Union(), 0,
+                          strings, vec, level);
+  }
+  FinishMonsterBuffer(builder, level);
+
+  flatbuffers::Verifier verifier(builder.GetBufferPointer(),
+                                 builder.GetSize(), 64, 100);
+  verifier.VerifySharedObjectsOnce();
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  TEST_EQ(GetMonster(builder.GetBufferPointer())->enemy()->hp(), 39);
+}
+
+void IterativeVerifyTest(const uint8_t *flatbuf, size_t length) {
+  flatbuffers::Verifier verifier(flatbuf, length);
+  TEST_EQ(verifier.VerifyBufferIteratively<Monster>(), true);
+
+  // Nesting far deeper than the default max_depth, which is the reason to
+  // verify iteratively at all.
+  flatbuffers::FlatBufferBuilder builder;
+  auto name = builder.CreateSharedString("M");
+  auto level = CreateMonster(builder, nullptr, 0, 0, name);
+  for (int i = 1; i < 5000; i++) {
+    // Refer to the level below through a vector, a union or a field in turn.
+    flatbuffers::Offset<Monster> below[] = { level };
+    auto vec = i % 3 == 0 ? builder.CreateVector(below, 1) : 0;
+    level = CreateMonster(builder, nullptr, 0, static_cast<int16_t>(i), name,
+                          0, Color_Blue, i % 3 == 1 ? Any_Monster : Any_NONE,
+                          i % 3 == 1 ? level.Union() : 0, 0, 0, vec,
+                          i % 3 == 2 ? level : 0);
+  }
+  FinishMonsterBuffer(builder, level);
+  flatbuffers::Verifier deep_verifier(builder.GetBufferPointer(),
+                                      builder.GetSize(), 5000);
+  TEST_EQ(deep_verifier.VerifyBufferIteratively<Monster>(), true);
+
+  // The same DAG as SharedVerifyTest() in VerifySharedObjectsOnce() mode.
+  builder.Clear();
+  name = builder.CreateSharedString("M");
+  auto strings = builder.CreateVectorOfStrings(2, [](size_t) { return "s"; });
+  level = CreateMonster(builder, nullptr, 0, 0, name, 0, Color_Blue,
+                        Any_NONE, 0, 0, strings);
+  for (int i = 1; i <= 40; i++) {
+    flatbuffers::Offset<Monster> below[] = { level, level };
+    auto vec = builder.CreateVector(below, 2);
+    level = CreateMonster(builder, nullptr, 0, static_cast<int16_t>(i), name,
+                          0, Color_Blue, Any_Monster, level.Union(), 0,
+                          strings, vec, level);
+  }
+  FinishMonsterBuffer(builder, level);
+  flatbuffers::Verifier dag_verifier(builder.GetBufferPointer(),
+                                     builder.GetSize(), 64, 100);
+  dag_verifier.VerifySharedObjectsOnce();
+  TEST_EQ(dag_verifier.VerifyBufferIteratively<Monster>(), true);
+
+  // A union type without a value is still checked, as the generated code
+  // does: an unknown type is an error, a known one is fine.
+  for (int type = Any_Monster; type <= 77; type += 77 - Any_Monster) {
+    builder.Clear();
+    FinishMonsterBuffer(builder, CreateMonster(builder, nullptr, 0, 0,
+                                               builder.CreateString("M"), 0,
+                                               Color_Blue,
+                                               static_cast<Any>(type)));
+    flatbuffers::Verifier recursive(builder.GetBufferPointer(),
+                                    builder.GetSize());
+    recursive.EnableDiagnostics();
+    flatbuffers::Verifier iterative(builder.GetBufferPointer(),
+                                    builder.GetSize());
+    iterative.EnableDiagnostics();
+    auto ok = type != 77;
+    TEST_EQ(VerifyMonsterBuffer(recursive), ok);
+    TEST_EQ(iterative.VerifyBufferIteratively<Monster>(), ok);
+    if (!ok)
+      TEST_EQ_STR(iterative.failure_reason(), "unknown union type");
+  }
+}
+
+void ParallelVerifyTest(const uint8_t *flatbuf, size_t length) {
+  flatbuffers::ParallelVerifier small(flatbuf, length, 64, 1000000, 4, 1);
+  TEST_EQ(small.VerifyBuffer<Monster>(), true);
+
+  // A snapshot-like buffer: a big vector of records, each with a vector of
+  // tables of its own.
+  flatbuffers::FlatBufferBuilder builder;
+  auto name = builder.CreateSharedString("M");
+  std::vector<flatbuffers::Offset<Monster>> records;
+  for (int i = 0; i < 5000; i++) {
+    auto leaf = CreateMonster(builder, nullptr, 0, static_cast<int16_t>(i),
+                              name);
+    flatbuffers::Offset<Monster> leaves[] = { leaf, leaf, leaf };
+    auto vec = builder.CreateVector(leaves, 3);
+    records.push_back(CreateMonster(builder, nullptr, 0, 0, name, 0,
+                                    Color_Blue, Any_NONE, 0, 0, 0, vec));
+  }
+  auto vec = builder.CreateVector(records);
+  auto root = CreateMonster(builder, nullptr, 0, 0, name, 0, Color_Blue,
+                            Any_NONE, 0, 0, 0, vec);
+  FinishMonsterBuffer(builder, root);
+
+  flatbuffers::Verifier verifier(builder.GetBufferPointer(), builder.GetSize());
+  TEST_EQ(verifier.VerifyBufferIteratively<Monster>(), true);
+  TEST_EQ(verifier.num_tables(), 1U + 5000U * 4U);
+  flatbuffers::ParallelVerifier parallel(builder.GetBufferPointer(),
+                                         builder.GetSize(), 64, 1000000, 4,
+                                         100);
+  TEST_EQ(parallel.VerifyBuffer<Monster>(), true);
+  TEST_EQ(parallel.num_tables(), verifier.num_tables());
+  // Exactly enough tables allowed.
+  flatbuffers::ParallelVerifier limited(builder.GetBufferPointer(),
+                                        builder.GetSize(), 64,
+                                        verifier.num_tables(), 4, 100);
+  TEST_EQ(limited.VerifyBuffer<Monster>(), true);
+}
+
+void CheckedAccessTest(const uint8_t *flatbuf, size_t length) {
+  flatbuffers::CheckedBuffer buffer(flatbuf, length);
+  auto monster = GetCheckedMonster(buffer);
+  TEST_EQ(monster.IsNull(), false);
+  TEST_EQ(monster.hp(), 80);
+  TEST_EQ(monster.mana(), 150);
+  TEST_EQ_STR(monster.name()->c_str(), "MyMonster");
+  TEST_EQ(monster.pos()->test3().a(), 10);
+  TEST_EQ(monster.inventory()->Get(9), 9);
+  TEST_EQ(monster.test4()->Get(1)->b(), 40);
+  TEST_EQ(monster.testarrayofstring().size(), 4U);
+  TEST_EQ_STR(monster.testarrayofstring().Get(1)->c_str(), "fred");
+  TEST_EQ(monster.testarrayoftables().size(), 3U);
+  TEST_EQ_STR(monster.testarrayoftables().Get(0).name()->c_str(), "Barney");
+  TEST_EQ(monster.testarrayoftables().Get(3).IsNull(), true);
+  TEST_EQ(monster.test_type(), Any_Monster);
+  TEST_EQ_STR(CheckedMonster(monster.test()).name()->c_str(), "Fred");
+  TEST_EQ(monster.enemy().IsNull(), true);
+  TEST_EQ(monster.enemy().hp(), 100);
+  TEST_EQ(buffer.ok(), true);
+
+  // Point the name far outside of the buffer: only that field is affected.
+  std::vector<uint8_t> corrupt(flatbuf, flatbuf + length);
+  auto name_field = reinterpret_cast<const flatbuffers::Table *>(
+    GetMonster(flatbuf))->GetAddressOf(Monster::VT_NAME);
+  flatbuffers::WriteScalar<flatbuffers::uoffset_t>(
+    &corrupt[name_field - flatbuf], 0x7FFFFFF0);
+  flatbuffers::CheckedBuffer corrupt_buffer(corrupt.data(), corrupt.size());
+  auto corrupt_monster = GetCheckedMonster(corrupt_buffer);
+  TEST_EQ(corrupt_monster.hp(), 80);
+  TEST_EQ(corrupt_buffer.ok(), true);
+  TEST_NOTNULL(corrupt_monster.pos());
+  TEST_EQ(corrupt_monster.name() == nullptr, true);
+  TEST_EQ(corrupt_buffer.ok(), false);
+
+  // A truncated buffer reads as all defaults.
+  flatbuffers::CheckedBuffer truncated(flatbuf, 2);
+  TEST_EQ(GetCheckedMonster(truncated).IsNull(), true);
+  TEST_EQ(GetCheckedMonster(truncated).hp(), 100);
+  TEST_EQ(truncated.ok(), false);
+}
+
+void VerifierDiagnosticsTest() {
+  flatbuffers::FlatBufferBuilder builder;
+  auto enemy = CreateMonster(builder, nullptr, 0, 0,
+                             builder.CreateString("Bad"));
+  flatbuffers::Offset<Monster> tables[] = {
+    CreateMonster(builder, nullptr, 0, 0, builder.CreateString("A")),
+    CreateMonster(builder, nullptr, 0, 0, builder.CreateString("B"), 0,
+                  Color_Blue, Any_Monster,
+                  CreateMonster(builder, nullptr, 0, 0,
+                                builder.CreateString("U")).Union()),
+    CreateMonster(builder, nullptr, 0, 0, builder.CreateString("C"), 0,
+                  Color_Blue, Any_NONE, 0, 0, 0, 0, enemy)
+  };
+  auto vec = builder.CreateVector(tables, 3);
+  FinishMonsterBuffer(builder, CreateMonster(builder, nullptr, 0, 0,
+                                             builder.CreateString("Root"), 0,
+                                             Color_Blue, Any_NONE, 0, 0, 0,
+                                             vec));
+  std::vector<uint8_t> buf(builder.GetBufferPointer(),
+                           builder.GetBufferPointer() + builder.GetSize());
+
+  flatbuffers::Verifier verifier(buf.data(), buf.size());
+  TEST_EQ(verifier.VerifyBufferIteratively<Monster>(), true);
+  TEST_EQ(verifier.failure_reason() == nullptr, true);
+  TEST_EQ(verifier.num_tables(), 6U);
+  TEST_EQ(verifier.max_depth_reached(), 3U);
+  TEST_EQ(verifier.bytes_verified() > 0, true);
+
+  // Make the string of the enemy run past the end of the buffer.
+  auto name = GetMonster(buf.data())->testarrayoftables()->Get(2)->enemy()->
+                name();
+  auto name_offset = reinterpret_cast<const uint8_t *>(name) - buf.data();
+  flatbuffers::WriteScalar<flatbuffers::uoffset_t>(&buf[name_offset], 0xFFFF);
+  flatbuffers::Verifier corrupt(buf.data(), buf.size());
+  corrupt.EnableDiagnostics();
+  TEST_EQ(corrupt.VerifyBufferIteratively<Monster>(), false);
+  TEST_EQ_STR(corrupt.failure_reason(), "out of bounds");
+  TEST_EQ(corrupt.failure_offset(), name_offset);
+  TEST_EQ_STR(corrupt.failure_path().c_str(),
+              "testarrayoftables[2].enemy.name");
+
+  // The recursive verifier reports the same, without a path.
+  flatbuffers::Verifier recursive(buf.data(), buf.size());
+  recursive.EnableDiagnostics();
+  TEST_EQ(recursive.VerifyBuffer<Monster>(), false);
+  TEST_EQ_STR(recursive.failure_reason(), "out of bounds");
+  TEST_EQ(recursive.failure_offset(), name_offset);
+  TEST_EQ(recursive.failure_path().empty(), true);
+
+  // An unknown union type.
+  flatbuffers::WriteScalar<flatbuffers::uoffset_t>(&buf[name_offset], 3);
+  auto tables_vec = GetMutableMonster(buf.data())->mutable_testarrayoftables();
+  TEST_EQ(const_cast<Monster *>(tables_vec->Get(1))->mutate_test_type(
+            static_cast<Any>(99)), true);
+  flatbuffers::Verifier bad_union(buf.data(), buf.size());
+  bad_union.EnableDiagnostics();
+  TEST_EQ(bad_union.VerifyBufferIteratively<Monster>(), false);
+  TEST_EQ_STR(bad_union.failure_reason(), "unknown union type");
+  TEST_EQ_STR(bad_union.failure_path().c_str(), "testarrayoftables[1].test");
+}
+
+void PrefetchingRangeTest() {
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  for (int i = 0; i < 100; i++) {
+    monsters.push_back(CreateMonster(builder, nullptr, 0,
+                                     static_cast<int16_t>(i),
+                                     builder.CreateString("M")));
+  }
+  auto vec = builder.CreateVector(monsters);
+  FinishMonsterBuffer(builder, CreateMonster(builder, nullptr, 0, 0,
+                                             builder.CreateString("Root"), 0,
+                                             Color_Blue, Any_NONE, 0, 0, 0,
+                                             vec));
+  auto tables = GetMonster(builder.GetBufferPointer())->testarrayoftables();
+
+  // Any distance visits the same elements in the same order, including
+  // distances beyond the end of the vector.
+  flatbuffers::uoffset_t distances[] = { 0, 1, 8, 1000 };
+  for (auto d = 0; d < 4; d++) {
+    flatbuffers::uoffset_t i = 0;
+    for (auto monster : tables->prefetching_range(distances[d])) {
+      TEST_EQ(monster, tables->Get(i));
+      TEST_EQ(monster->hp(), static_cast<int16_t>(i));
+      i++;
+    }
+    TEST_EQ(i, 100U);
+  }
+
+  builder.Clear();
+  FinishMonsterBuffer(builder, CreateMonster(builder, nullptr, 0, 0,
+                                             builder.CreateString("Root"), 0,
+                                             Color_Blue, Any_NONE, 0, 0, 0,
+                                             builder.CreateVector(
+                                               monsters.data(), 0)));
+  tables = GetMonster(builder.GetBufferPointer())->testarrayoftables();
+  auto range = tables->prefetching_range();
+  TEST_EQ(range.begin() == range.end(), true);
+}
+
+void GatherFieldTest() {
+  // Alternate tables with and without hp, such that runs of tables share
+  // vtables and runs of absent fields read the default.
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  for (int i = 0; i < 50; i++) {
+    auto hp = i % 10 < 5 ? static_cast<int16_t>(i) : int16_t(100);
+    monsters.push_back(CreateMonster(builder, nullptr, 150, hp,
+                                     builder.CreateString("M"), 0,
+                                     i % 2 ? Color_Red : Color_Blue));
+  }
+  auto vec = builder.CreateVector(monsters);
+  FinishMonsterBuffer(builder, CreateMonster(builder, nullptr, 0, 0,
+                                             builder.CreateString("Root"), 0,
+                                             Color_Blue, Any_NONE, 0, 0, 0,
+                                             vec));
+  auto &tables = *GetMonster(builder.GetBufferPointer())->testarrayoftables();
+
+  std::vector<int16_t> hp(tables.size());
+  Monster::gather_hp(tables, hp.data());
+  std::vector<int8_t> color(tables.size());
+  Monster::gather_color(tables, color.data());
+  // Never stored, as it's always the default.
+  std::vector<int16_t> mana(tables.size(), 0);
+  flatbuffers::GatherField<int16_t>(tables, Monster::VT_MANA, 150,
+                                    mana.data());
+  for (flatbuffers::uoffset_t i = 0; i < tables.size(); i++) {
+    TEST_EQ(hp[i], tables.Get(i)->hp());
+    TEST_EQ(color[i], tables.Get(i)->color());
+    TEST_EQ(mana[i], 150);
+  }
+}
+
+// Both lookups must find every key, and nothing else, for vectors of any
+// size (Eytzinger order fills the last level of its tree partially).
+void KeyLookupTest() {
+  for (int size = 0; size <= 70; size += size < 10 ? 1 : 20) {
+    flatbuffers::FlatBufferBuilder builder;
+    std::vector<flatbuffers::Offset<reflection::EnumVal>> vals;
+    for (int i = 0; i < size; i++) {
+      vals.push_back(reflection::CreateEnumVal(
+        builder, builder.CreateString("v"), static_cast<int64_t>(i) * 2));
+    }
+    std::vector<flatbuffers::Offset<reflection::EnumVal>> copy(vals);
+    auto sorted = builder.CreateVectorOfSortedTables(&vals);
+    auto eytzinger = builder.CreateVectorOfEytzingerTables(&copy);
+    builder.Finish(sorted);
+    auto end = builder.GetBufferPointer() + builder.GetSize();
+    typedef flatbuffers::Vector<flatbuffers::Offset<reflection::EnumVal>>
+      EnumVals;
+    auto sorted_vec = reinterpret_cast<const EnumVals *>(end - sorted.o);
+    auto eytzinger_vec = reinterpret_cast<const EnumVals *>(end - eytzinger.o);
+    for (int64_t key = -1; key <= size * 2; key++) {
+      auto a = sorted_vec->LookupByKey(key);
+      auto b = eytzinger_vec->LookupByKeyEytzinger(key);
+      if (key >= 0 && key < size * 2 && key % 2 == 0) {
+        TEST_NOTNULL(a);
+        TEST_EQ(a, b);
+        TEST_EQ(a->value(), key);
+      } else {
+        TEST_EQ(a == nullptr, true);
+        TEST_EQ(b == nullptr, true);
+      }
+    }
+  }
+
+  // String keys.
+  flatbuffers::FlatBufferBuilder builder;
+  const char *names[] = { "Barney", "Fred", "Wilma", "Betty", "Dino" };
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  for (int i = 0; i < 5; i++) {
+    monsters.push_back(CreateMonster(builder, nullptr, 0, 0,
+                                     builder.CreateString(names[i])));
+  }
+  auto vec = builder.CreateVectorOfEytzingerTables(&monsters);
+  builder.Finish(vec);
+  auto monster_vec = reinterpret_cast<
+    const flatbuffers::Vector<flatbuffers::Offset<Monster>> *>(
+      builder.GetBufferPointer() + builder.GetSize() - vec.o);
+  // The root of the tree, with Barney, Betty and Dino on its left.
+  TEST_EQ_STR(monster_vec->Get(0)->name()->c_str(), "Fred");
+  for (int i = 0; i < 5; i++) {
+    TEST_EQ_STR(monster_vec->LookupByKeyEytzinger(names[i])->name()->c_str(),
+                names[i]);
+  }
+  TEST_EQ(monster_vec->LookupByKeyEytzinger("Pebbles") == nullptr, true);
+
+  // The generated lookups of (key_layout: "eytzinger") fields, for string,
+  // scalar and (scoped) enum keys.
+  using namespace MyGame::KeyLookup;
+  builder.Clear();
+  std::vector<flatbuffers::Offset<Named>> named;
+  std::vector<flatbuffers::Offset<Numbered>> numbered;
+  std::vector<flatbuffers::Offset<Typed>> typed;
+  for (int i = 0; i < 5; i++) {
+    named.push_back(CreateNamed(builder, builder.CreateString(names[i])));
+    numbered.push_back(CreateNumbered(builder, 10 - i * 3));
+  }
+  typed.push_back(CreateTyped(builder, Element::Air));
+  typed.push_back(CreateTyped(builder, Element::Fire));
+  typed.push_back(CreateTyped(builder, Element::Earth));
+  FinishCatalogBuffer(builder, CreateCatalog(
+    builder, 0, 0, builder.CreateVectorOfEytzingerTables(&named),
+    builder.CreateVectorOfEytzingerTables(&numbered),
+    builder.CreateVectorOfEytzingerTables(&typed)));
+  auto catalog = GetCatalog(builder.GetBufferPointer());
+  for (int i = 0; i < 5; i++) {
+    TEST_EQ_STR(catalog->named_by_key(names[i])->name()->c_str(), names[i]);
+    TEST_EQ(catalog->numbered_by_key(10 - i * 3)->number(), 10 - i * 3);
+  }
+  TEST_EQ(catalog->named_by_key("Pebbles") == nullptr, true);
+  TEST_EQ(catalog->numbered_by_key(0) == nullptr, true);
+  TEST_EQ(catalog->typed_by_key(Element::Earth)->element() == Element::Earth,
+          true);
+  TEST_EQ(catalog->typed_by_key(Element::Water) == nullptr, true);
+}
+
+void HashIndexTest() {
+  for (int size = 0; size <= 100; size += size < 3 ? 1 : 97) {
+    flatbuffers::FlatBufferBuilder builder;
+    std::vector<flatbuffers::Offset<Monster>> monsters;
+    for (int i = 0; i < size; i++) {
+      monsters.push_back(CreateMonster(builder, nullptr, 0, 0,
+        builder.CreateString("M" + flatbuffers::NumToString(i))));
+    }
+    auto vec = builder.CreateVectorOfSortedTables(&monsters);
+    auto index = builder.CreateHashIndex(monsters);
+    builder.Finish(vec);
+    auto end = builder.GetBufferPointer() + builder.GetSize();
+    auto monster_vec = reinterpret_cast<
+      const flatbuffers::Vector<flatbuffers::Offset<Monster>> *>(end - vec.o);
+    auto index_vec = reinterpret_cast<const flatbuffers::Vector<uint32_t> *>(
+      end - index.o);
+    for (int i = 0; i < size; i++) {
+      auto name = "M" + flatbuffers::NumToString(i);
+      auto monster = monster_vec->LookupByKeyHashed(name.c_str(), index_vec);
+      TEST_NOTNULL(monster);
+      TEST_EQ_STR(monster->name()->c_str(), name.c_str());
+      // Without an index, the same is found by binary search.
+      TEST_EQ(monster_vec->LookupByKeyHashed(name.c_str(), nullptr), monster);
+    }
+    TEST_EQ(monster_vec->LookupByKeyHashed("Pebbles", index_vec) == nullptr,
+            true);
+  }
+
+  // The index field is added after the vector, with the next id.
+  flatbuffers::Parser parser;
+  TEST_EQ(parser.Parse("table E { n:string (key); }"
+                       "table D { e:[E] (hash_index, id: 0); x:int (id: 2); }"),
+          true);
+  auto index_field = parser.structs_.Lookup("D")->fields.Lookup("e_hash_index");
+  TEST_NOTNULL(index_field);
+  TEST_EQ(index_field->value.type.element, flatbuffers::BASE_TYPE_UINT);
+  TEST_EQ_STR(index_field->attributes.Lookup("id")->constant.c_str(), "1");
+
+  // The generated lookup of a (hash_index) field. The index is passed to
+  // Create<Table>() like any other field.
+  using namespace MyGame::KeyLookup;
+  TEST_EQ(static_cast<int>(Catalog::VT_HASHED_HASH_INDEX),
+          static_cast<int>(flatbuffers::FieldIndexToOffset(1)));
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<flatbuffers::Offset<Named>> named;
+  for (int i = 0; i < 10; i++) {
+    named.push_back(CreateNamed(builder, builder.CreateString(
+                                  "N" + flatbuffers::NumToString(i))));
+  }
+  auto vec = builder.CreateVectorOfSortedTables(&named);
+  auto index = builder.CreateHashIndex(named);  // In the sorted order.
+  FinishCatalogBuffer(builder, CreateCatalog(builder, vec, index));
+  auto catalog = GetCatalog(builder.GetBufferPointer());
+  TEST_EQ(catalog->hashed_hash_index()->size() >= catalog->hashed()->size(),
+          true);
+  for (int i = 0; i < 10; i++) {
+    auto name = "N" + flatbuffers::NumToString(i);
+    TEST_EQ_STR(catalog->hashed_by_key(name.c_str())->name()->c_str(),
+                name.c_str());
+  }
+  TEST_EQ(catalog->hashed_by_key("N10") == nullptr, true);
+  flatbuffers::Verifier verifier(builder.GetBufferPointer(),
+                                 builder.GetSize());
+  TEST_EQ(VerifyCatalogBuffer(verifier), true);
+}
+
+void VTableCacheTest(const uint8_t *flatbuf) {
+  flatbuffers::VTableCache cache;
+  auto monster = GetMonster(flatbuf);
+  auto root = reinterpret_cast<const flatbuffers::Table *>(monster);
+  TEST_EQ(root->GetField<int16_t>(cache, Monster::VT_HP, 100),
+          monster->hp());
+  TEST_EQ(root->GetField<int16_t>(cache, Monster::VT_MANA, 150), 150);
+  TEST_EQ(root->GetPointer<const flatbuffers::String *>(cache,
+                                                        Monster::VT_NAME),
+          monster->name());
+  TEST_EQ(root->GetStruct<const Vec3 *>(cache, Monster::VT_POS),
+          monster->pos());
+  TEST_EQ(root->GetPointer<const Monster *>(cache, Monster::VT_ENEMY) ==
+            nullptr, true);
+
+  // Tables of more shapes than the cache holds, in turn.
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  for (int i = 0; i < 64; i++) {
+    monsters.push_back(CreateMonster(builder, nullptr,
+                                     static_cast<int16_t>(i % 2 ? i : 150),
+                                     static_cast<int16_t>(i % 3 ? i : 100),
+                                     builder.CreateString("M"), 0,
+                                     i % 5 ? Color_Red : Color_Blue,
+                                     Any_NONE, 0, 0, 0, 0, 0, 0, 0,
+                                     i % 7 == 0));
+  }
+  auto vec = builder.CreateVector(monsters);
+  FinishMonsterBuffer(builder, CreateMonster(builder, nullptr, 0, 0,
+                                             builder.CreateString("Root"), 0,
+                                             Color_Blue, Any_NONE, 0, 0, 0,
+                                             vec));
+  auto tables = GetMonster(builder.GetBufferPointer())->testarrayoftables();
+  for (auto it = tables->begin(); it != tables->end(); ++it) {
+    auto t = reinterpret_cast<const flatbuffers::Table *>(*it);
+    TEST_EQ(t->GetField<int16_t>(cache, Monster::VT_HP, 100), it->hp());
+    TEST_EQ(t->GetField<int16_t>(cache, Monster::VT_MANA, 150), it->mana());
+    TEST_EQ(t->GetField<int8_t>(cache, Monster::VT_COLOR, 8),
+            static_cast<int8_t>(it->color()));
+    TEST_EQ(t->GetField<uint8_t>(cache, Monster::VT_TESTBOOL, 0) != 0,
+            it->testbool());
+    TEST_EQ_STR(t->GetPointer<const flatbuffers::String *>(
+                  cache, Monster::VT_NAME)->c_str(), "M");
+  }
+
+  // Entries are found by the address of the vtable, so memory that now holds
+  // another buffer needs a Clear(). Here the vtable changes in place.
+  std::vector<uint8_t> mem(builder.GetBufferPointer(),
+                           builder.GetBufferPointer() + builder.GetSize());
+  auto reused = GetMonster(mem.data())->testarrayoftables()->Get(2);
+  auto t = reinterpret_cast<const flatbuffers::Table *>(reused);
+  TEST_EQ(t->GetField<int16_t>(cache, Monster::VT_HP, 100), 2);
+  auto data = reinterpret_cast<uint8_t *>(const_cast<Monster *>(reused));
+  auto vtable = data - flatbuffers::ReadScalar<flatbuffers::soffset_t>(data);
+  flatbuffers::WriteScalar<flatbuffers::voffset_t>(vtable + Monster::VT_HP, 0);
+  TEST_EQ(t->GetField<int16_t>(cache, Monster::VT_HP, 100), 2);  // Stale.
+  cache.Clear();
+  TEST_EQ(t->GetField<int16_t>(cache, Monster::VT_HP, 100), 100);
+
+  // The accessors generated with --gen-vtable-cache. The second catalog
+  // reuses the memory of the first, with a vtable of the same size and
+  // address that has another field set.
+  using namespace MyGame::KeyLookup;
+  auto build_catalog = [](flatbuffers::FlatBufferBuilder &fbb, bool typed) {
+    fbb.Clear();
+    auto numbered = typed ? 0 : fbb.CreateVector(
+      std::vector<flatbuffers::Offset<Numbered>>());
+    auto typed_vec = typed ? fbb.CreateVector(
+      std::vector<flatbuffers::Offset<Typed>>()) : 0;
+    FinishCatalogBuffer(fbb, CreateCatalog(fbb, 0, 0, 0, numbered, typed_vec,
+                                           7));
+  };
+  flatbuffers::VTableCache catalog_cache;
+  build_catalog(builder, false);
+  std::vector<uint8_t> catalog_mem(builder.GetBufferPointer(),
+                                   builder.GetBufferPointer() +
+                                     builder.GetSize());
+  auto catalog = GetCatalog(catalog_mem.data());
+  TEST_EQ(catalog->count(catalog_cache), 7);
+  TEST_EQ(catalog->numbered(catalog_cache), catalog->numbered());
+  TEST_EQ(catalog->typed(catalog_cache) == nullptr, true);
+  TEST_EQ(catalog->named(catalog_cache) == nullptr, true);
+  build_catalog(builder, true);
+  TEST_EQ(builder.GetSize(), catalog_mem.size());
+  memcpy(catalog_mem.data(), builder.GetBufferPointer(), builder.GetSize());
+  TEST_EQ(catalog->typed(catalog_cache) == nullptr, true);  // Stale.
+  catalog_cache.Clear();
+  TEST_EQ(catalog->count(catalog_cache), 7);
+  TEST_EQ(catalog->numbered(catalog_cache) == nullptr, true);
+  TEST_EQ(catalog->typed(catalog_cache), catalog->typed());
+  TEST_NOTNULL(catalog->typed(catalog_cache));
+
+  // Fields past those the cache decodes.
+  std::string schema = "table T {";
+  std::string json = "{";
+  for (int i = 0; i < 40; i++) {
+    schema += " f" + flatbuffers::NumToString(i) + ":int;";
+    if (i % 3) json += " f" + flatbuffers::NumToString(i) + ": " +
+                       flatbuffers::NumToString(i) + ",";
+  }
+  schema += " } root_type T;";
+  json += " }";
+  flatbuffers::Parser parser;
+  TEST_EQ(parser.Parse(schema.c_str()), true);
+  TEST_EQ(parser.Parse(json.c_str()), true);
+  auto table = flatbuffers::GetRoot<flatbuffers::Table>(
+    parser.builder_.GetBufferPointer());
+  flatbuffers::VTableCache table_cache;
+  for (int i = 0; i < 42; i++) {
+    auto field = flatbuffers::FieldIndexToOffset(
+      static_cast<flatbuffers::voffset_t>(i));
+    TEST_EQ(table->GetField<int32_t>(table_cache, field, -1),
+            i < 40 && i % 3 ? i : -1);
+  }
+}
+
+void SchemaVerifyTest(const uint8_t *flatbuf, size_t length) {
+  std::string bfbsfile;
+  TEST_EQ(flatbuffers::LoadFile(
+    "tests/monster_test.bfbs", true, &bfbsfile), true);
+  auto &schema = *reflection::GetSchema(bfbsfile.c_str());
+
+  flatbuffers::SchemaVerifier schema_verifier(schema);
+  TEST_EQ(schema_verifier.VerifyBuffer(*schema.root_table(), flatbuf, length),
+          true);
+  TEST_EQ(flatbuffers::VerifyBuffer(schema, *schema.root_table(), flatbuf,
+                                    length), true);
+  TEST_EQ(schema_verifier.GetDescriptor(
+            *schema.objects()->LookupByKey("Vec3")) == nullptr,
+          true);
+
+  // The plan built from the schema checks as much as the generated one.
+  flatbuffers::Verifier generated(flatbuf, length);
+  TEST_EQ(generated.VerifyBufferIteratively<Monster>(), true);
+  flatbuffers::Verifier from_schema(flatbuf, length);
+  TEST_EQ(from_schema.Verify<flatbuffers::uoffset_t>(flatbuf), true);
+  TEST_EQ(from_schema.VerifyTableIteratively(
+            flatbuf + flatbuffers::ReadScalar<flatbuffers::uoffset_t>(flatbuf),
+            schema_verifier.GetDescriptor(*schema.root_table())), true);
+  TEST_EQ(from_schema.num_tables(), generated.num_tables());
+
+  // Corrupt and truncated buffers get the same verdict either way. This
+  // follows SchemaVerifier::VerifyBuffer(), with diagnostics on such that
+  // failures don't assert.
+  auto root_desc = schema_verifier.GetDescriptor(*schema.root_table());
+  auto by_schema = [&](const uint8_t *buf, size_t len) {
+    flatbuffers::Verifier verifier(buf, len);
+    verifier.EnableDiagnostics();
+    return verifier.Verify<flatbuffers::uoffset_t>(buf) &&
+           verifier.VerifyTableIteratively(
+             buf + flatbuffers::ReadScalar<flatbuffers::uoffset_t>(buf),
+             root_desc);
+  };
+  auto by_code = [&](const uint8_t *buf, size_t len) {
+    flatbuffers::Verifier verifier(buf, len);
+    verifier.EnableDiagnostics();
+    return VerifyMonsterBuffer(verifier);
+  };
+  std::vector<uint8_t> copy(flatbuf, flatbuf + length);
+  size_t rejected = 0;
+  for (size_t i = 0; i < length; i++) {
+    const uint8_t values[] = { 0, 1, 0x7F, 0x80, 0xFF };
+    for (size_t j = 0; j < sizeof(values); j++) {
+      copy[i] = values[j];
+      auto ok = by_code(copy.data(), length);
+      TEST_EQ(by_schema(copy.data(), length), ok);
+      if (!ok) rejected++;
+    }
+    copy[i] = flatbuf[i];
+  }
+  TEST_EQ(rejected > 0, true);
+  // The last few bytes of this buffer are padding, which may be cut off.
+  for (size_t len = 0; len < length; len++) {
+    auto ok = by_code(copy.data(), len);
+    TEST_EQ(by_schema(copy.data(), len), ok);
+    if (len + sizeof(flatbuffers::uoffset_t) <= length) TEST_EQ(ok, false);
+  }
+}
+
 int main(int /*argc*/, const char * /*argv*/[]) {
   // Run our various test suites:
 
@@ -869,6 +2197,7 @@ int main(int /*argc*/, const char * /*argv*/[]) {
   #ifndef FLATBUFFERS_NO_FILE_TESTS
   ParseAndGenerateTextTest();
   ReflectionTest(flatbuf.get(), rawbuf.length());
+  SchemaVerifyTest(flatbuf.get(), rawbuf.length());
   ParseProtoTest();
   #endif
 
@@ -880,6 +2209,30 @@ int main(int /*argc*/, const char * /*argv*/[]) {
   EnumStringsTest();
   UnicodeTest();
   UnknownFieldsTest();
+  VTableDedupTest();
+  AllocatorTest();
+  BuilderPoolTest();
+  SegmentedBuildTest();
+  SegmentedSharingTest();
+  SizeBoundTest();
+  SharedStringTest();
+  SortedTablesTest();
+  SpliceTest();
+  DirectTableTest();
+  SizePrefixedTest();
+  BuilderStatsTest();
+  GeneratedVectorTest();
+  SharedTableTest();
+  SharedVerifyTest();
+  IterativeVerifyTest(flatbuf.get(), rawbuf.length());
+  ParallelVerifyTest(flatbuf.get(), rawbuf.length());
+  CheckedAccessTest(flatbuf.get(), rawbuf.length());
+  VerifierDiagnosticsTest();
+  PrefetchingRangeTest();
+  GatherFieldTest();
+  KeyLookupTest();
+  HashIndexTest();
+  VTableCacheTest(flatbuf.get());
 
   if (!testing_fails) {
     TEST_OUTPUT_LINE("ALL TESTS PASSED");